@@ -12,19 +12,28 @@
 #include "grid_base/astar/astar.h"
 #include "grid_base/bfs/bfs.h"
 #include "grid_base/dfs/dfs.h"
+#include "grid_base/theta_star/theta_star.h"
 #include "utility/common_grid_base.h"
 
 #include "tools/visualizer/visualizer.h"
+#include "tree_base/fmt_star/fmt_star.h"
+#include "tree_base/parallel_rrt_star/parallel_rrt_star.h"
+#include "tree_base/prm/prm.h"
 #include "tree_base/rrt/rrt.h"
+#include "tree_base/rrt_connect/rrt_connect.h"
 #include "tree_base/rrt_star/rrt_star.h"
 #include "utility/i_planning.h"
+#include "utility/search_trace.h"
 #include "yaml-cpp/yaml.h"
 
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -46,6 +55,8 @@ int main(int argc, char **argv)
   // Map config
   std::string map_file = data_directory + config["map"].as<std::string>();
   const auto map = std::make_shared<planning::Map>(map_file);
+  // 8 connectivity never rejects a query that any planner could solve.
+  map->EnableComponentLabels(8);
 
   // Planner config
   auto planner_name = config["planner_name"].as<std::string>();
@@ -68,10 +79,19 @@ int main(int argc, char **argv)
   // Visualize start and goal nodes
   visualizer->SetStartAndGoal(start_node, goal_node);
 
+  // Optional binary trace of every run, replayed with tools/trace_replay.
+  auto trace_file = config["trace_file"].as<std::string>("");
+  auto traced_planner =
+      std::dynamic_pointer_cast<planning::PlanningWithContext>(planner);
+  auto prm_planner =
+      std::dynamic_pointer_cast<planning::tree_base::PRM>(planner);
+
   while (visualizer->IsRunning())
     {
-      visualizer->SetGetLogFunction(
-          std::bind(&planning::IPlanningWithLogging::GetLog, planner));
+      visualizer->SetReadLogFunction(
+          [planner](planning::LogCursor &cursor, planning::Log &log) {
+            planner->ReadLog(cursor, log);
+          });
       std::cout << "Started" << std::endl;
       // Get time
       auto start_time{std::chrono::high_resolution_clock::now()};
@@ -81,10 +101,35 @@ int main(int argc, char **argv)
                           end_time - start_time)
                           .count();
       std::cout << "Planning Duration: " << duration << " ms" << std::endl;
+      const auto stats = planner->GetStats();
+      std::cout << "Expanded: " << stats.nodes_expanded
+                << " Generated: " << stats.nodes_generated
+                << " Collision checks: " << stats.collision_checks << std::endl;
+      if (prm_planner != nullptr && prm_planner->HasRoadmapSaveFailed())
+        {
+          std::cout << "Roadmap could not be saved to "
+                    << config["roadmap_file"].as<std::string>() << std::endl;
+        }
+      if (!trace_file.empty())
+        {
+          std::ofstream stream(trace_file, std::ios::binary);
+          planning::SearchTraceWriter trace(stream, planner_name, *map);
+          if (traced_planner != nullptr)
+            {
+              planning::LogCursor cursor;
+              traced_planner->ReadTrace(cursor, trace);
+            }
+          else
+            {
+              // Only the final tree of the query is kept, not its order.
+              planning::WriteLogTrace(planner->GetLog(), trace);
+            }
+          trace.AddPath(path);
+        }
       std::this_thread::sleep_for(std::chrono::milliseconds(1000));
       std::cout << "Finished" << std::endl;
-      // set null to get_log_function_ to stop logging
-      visualizer->SetGetLogFunction(nullptr);
+      // set null to read_log_function_ to stop logging
+      visualizer->SetReadLogFunction(nullptr);
       planner->ClearLog();
     }
 
@@ -94,11 +139,16 @@ int main(int argc, char **argv)
 PlannerType GetPlanner(std::string planner_name)
 {
   PlannerType result{};
-  if (planner_name == "astar" || planner_name == "bfs" || planner_name == "dfs")
+  if (planner_name == "astar" || planner_name == "bfs" ||
+      planner_name == "dfs" || planner_name == "theta_star" ||
+      planner_name == "lazy_theta_star")
     {
       result = GetGridBasedPlanner(planner_name);
     }
-  else if (planner_name == "rrt" || planner_name == "rrt_star")
+  else if (planner_name == "rrt" || planner_name == "rrt_star" ||
+           planner_name == "rrt_connect" ||
+           planner_name == "parallel_rrt_star" || planner_name == "fmt_star" ||
+           planner_name == "prm" || planner_name == "lazy_prm")
     {
       result = GetTreeBasedPlanner(planner_name);
     }
@@ -133,6 +183,11 @@ PlannerType GetGridBasedPlanner(std::string planner_name)
     {
       planner = std::make_shared<planning::grid_base::DFS>(search_space);
     }
+  else if (planner_name == "theta_star" || planner_name == "lazy_theta_star")
+    {
+      planner = std::make_shared<planning::grid_base::ThetaStar>(
+          heuristic_weight, search_space, planner_name == "lazy_theta_star");
+    }
   else
     {
       std::cout << "Invalid planner name" << std::endl;
@@ -152,17 +207,77 @@ PlannerType GetTreeBasedPlanner(std::string planner_name)
   auto neighbor_radius = config["neighbor_radius"].as<int>();
   auto goal_radius = config["goal_radius"].as<int>();
 
+  // Optional fixed sampler seed for reproducible runs.
+  auto seed = config["seed"] ? config["seed"].as<std::uint64_t>()
+                             : std::random_device{}();
+
   PlannerType planner;
   if (planner_name == "rrt")
     {
-      planner = std::make_shared<planning::tree_base::RRT>(
+      auto rrt = std::make_shared<planning::tree_base::RRT>(
           max_iteration, max_branch_length, min_branch_length, goal_radius);
+      rrt->SetSeed(seed);
+      planner = rrt;
     }
   else if (planner_name == "rrt_star")
     {
-      planner = std::make_shared<planning::tree_base::RRTStar>(
+      auto rrt_star = std::make_shared<planning::tree_base::RRTStar>(
           max_iteration, max_branch_length, min_branch_length, neighbor_radius,
           goal_radius);
+      rrt_star->SetSeed(seed);
+      rrt_star->SetInformed(config["informed"].as<bool>(false));
+      rrt_star->SetLazyCollisionChecking(
+          config["lazy_collision_checking"].as<bool>(false));
+      rrt_star->SetGoalBias(config["goal_bias"].as<double>(0.0));
+
+      // Zero disables a rule.
+      planning::TerminationCondition termination;
+      termination.SetTimeBudget(
+          std::chrono::milliseconds(config["time_budget_ms"].as<int>(0)));
+      termination.SetTargetCost(config["target_cost"].as<double>(0.0));
+      termination.SetStallLimit(
+          config["stall_iterations"].as<int>(0),
+          std::chrono::milliseconds(config["stall_time_ms"].as<int>(0)));
+      rrt_star->SetTerminationCondition(termination);
+      planner = rrt_star;
+    }
+  else if (planner_name == "rrt_connect")
+    {
+      auto rrt_connect = std::make_shared<planning::tree_base::RRTConnect>(
+          max_iteration, max_branch_length, min_branch_length);
+      rrt_connect->SetSeed(seed);
+      planner = rrt_connect;
+    }
+  else if (planner_name == "parallel_rrt_star")
+    {
+      // Zero thread count uses every hardware thread.
+      auto parallel_rrt_star =
+          std::make_shared<planning::tree_base::ParallelRRTStar>(
+              max_iteration, max_branch_length, min_branch_length,
+              neighbor_radius, goal_radius,
+              config["thread_count"].as<unsigned int>(0));
+      parallel_rrt_star->SetSeed(seed);
+      planner = parallel_rrt_star;
+    }
+  else if (planner_name == "fmt_star")
+    {
+      // Samples are added batch_size at a time until max_iteration samples.
+      auto fmt_star = std::make_shared<planning::tree_base::FMTStar>(
+          max_iteration, config["batch_size"].as<int>(2000), neighbor_radius);
+      fmt_star->SetSeed(seed);
+      planner = fmt_star;
+    }
+  else if (planner_name == "prm" || planner_name == "lazy_prm")
+    {
+      // Roadmap is built on the first query and reused for the same map.
+      auto prm = std::make_shared<planning::tree_base::PRM>(
+          config["roadmap_sample_count"].as<int>(2000),
+          config["roadmap_neighbor_count"].as<int>(10),
+          config["thread_count"].as<unsigned int>(0));
+      prm->SetSeed(seed);
+      prm->SetLazy(planner_name == "lazy_prm");
+      prm->SetRoadmapFile(config["roadmap_file"].as<std::string>(""));
+      planner = prm;
     }
   else
     {
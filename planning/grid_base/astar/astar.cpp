@@ -11,11 +11,11 @@
 
 #include "astar.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <iostream>
 #include <memory>
-#include <queue>
 #include <thread>
 
 namespace planning
@@ -32,7 +32,9 @@ auto heuristic{[](const Node &lhs, const Node &rhs) {
   return std::hypot(lhs.x_ - rhs.x_, lhs.y_ - rhs.y_);
 }};
 
-AStar::AStar(const double &heuristic_weight, const int search_space)
+template <typename Logging>
+BasicAStar<Logging>::BasicAStar(const double &heuristic_weight,
+                                const int search_space)
     : heuristic_weight_(heuristic_weight)
 {
 
@@ -50,37 +52,88 @@ AStar::AStar(const double &heuristic_weight, const int search_space)
     }
 }
 
-Path AStar::FindPath(const Node &start_node, const Node &goal_node,
-                     const std::shared_ptr<Map> map)
+template <typename Logging>
+std::unique_ptr<PlanningContext> BasicAStar<Logging>::CreateContext() const
 {
-  ClearLog();
-  std::shared_ptr<Map> map_copy = std::make_shared<Map>(*map);
-  map_copy->SetNodeState(goal_node, NodeState::kGoal);
+  return std::make_unique<Context>();
+}
 
-  std::priority_queue<std::shared_ptr<NodeParent>,
-                      std::vector<std::shared_ptr<NodeParent>>,
-                      decltype(Compare)>
-      search_list(Compare);
+template <typename Logging>
+void BasicAStar<Logging>::Begin(const Node &start_node, const Node &goal_node,
+                                const std::shared_ptr<Map> map,
+                                PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  context.ClearLog();
+  context.open_list.clear();
+  context.SetRunning();
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      std::cout << "No path found." << std::endl;
+      context.SetResult(Path{});
+      return;
+    }
+  context.goal_node = goal_node;
+  context.map->CopyCells(*map);
+  context.map->SetNodeState(goal_node, NodeState::kGoal);
 
-  auto start_node_info = std::make_shared<NodeParent>(
+  context.open_list.push_back(std::make_shared<NodeParent>(
       start_node, nullptr,
-      Cost(0, heuristic(start_node, goal_node), heuristic_weight_));
+      Cost(0, heuristic(start_node, goal_node), heuristic_weight_)));
+  context.stats.nodes_generated = 1;
+  context.stats.allocations = 1;
+  context.stats.open_list_peak = 1;
+}
 
-  search_list.push(start_node_info);
+template <typename Logging>
+PlanningStatus
+BasicAStar<Logging>::Step(const std::size_t iterations,
+                          PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  if (context.GetStatus() != PlanningStatus::kRunning)
+    {
+      return context.GetStatus();
+    }
 
-  while (!search_list.empty() && !IsGoal(search_list.top()->node, goal_node))
+  PhaseTimer timer(context.stats.total_time);
+
+  auto &stats{context.stats};
+  // Same heap operations as std::priority_queue, kept in the context so the
+  // search can be resumed.
+  auto &search_list{context.open_list};
+  const auto &goal_node{context.goal_node};
+  const auto &map_copy{context.map};
+  for (std::size_t i = 0; i < iterations; i++)
     {
-      auto current_node = search_list.top();
-      search_list.pop();
+      if (search_list.empty())
+        {
+          std::cout << "No path found." << std::endl;
+          return context.SetResult(Path{});
+        }
+      if (IsGoal(search_list.front()->node, goal_node))
+        {
+          auto current_node = search_list.front();
+          context.template SetGoalInLog<Logging>(current_node);
+          auto path = ReconstructPath(current_node);
+          map_copy->UpdateMapWithPath(path);
+          return context.SetResult(path);
+        }
+      if (context.ShouldStop())
+        {
+          return context.SetResult(Path{});
+        }
+
+      std::pop_heap(search_list.begin(), search_list.end(), Compare);
+      auto current_node = search_list.back();
+      search_list.pop_back();
 
       if (!IsFree(current_node->node, map_copy))
         {
           continue;
         }
-      {
-        std::lock_guard<std::mutex> lock(log_mutex_);
-        log_.first.emplace_back(current_node);
-      }
+      context.template AddToLog<Logging>(current_node);
+      stats.nodes_expanded++;
 
       map_copy->SetNodeState(current_node->node, NodeState::kVisited);
 
@@ -94,30 +147,22 @@ Path AStar::FindPath(const Node &start_node, const Node &goal_node,
               continue;
             }
 
-          auto neighbor_node = std::make_shared<NodeParent>(
+          search_list.push_back(std::make_shared<NodeParent>(
               Node(x, y), current_node,
               Cost(current_node->cost.g + 1, heuristic(Node(x, y), goal_node),
-                   heuristic_weight_));
-
-          search_list.push(neighbor_node);
+                   heuristic_weight_)));
+          std::push_heap(search_list.begin(), search_list.end(), Compare);
+          stats.nodes_generated++;
+          stats.allocations++;
         }
+      stats.open_list_peak =
+          std::max(stats.open_list_peak, search_list.size());
     }
-
-  if (search_list.empty())
-    {
-      std::cout << "No path found." << std::endl;
-      return Path{};
-    }
-
-  auto current_node = search_list.top();
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.second = current_node;
-  }
-  auto path = ReconstructPath(current_node);
-  map_copy->UpdateMapWithPath(path);
-  return path;
+  return PlanningStatus::kRunning;
 }
 
+template class BasicAStar<ExpansionLogging>;
+template class BasicAStar<NoLogging>;
+
 } // namespace grid_base
 } // namespace planning
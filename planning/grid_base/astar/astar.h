@@ -15,8 +15,8 @@
 #include "utility/common_grid_base.h"
 #include "utility/i_planning.h"
 
+#include <cstddef>
 #include <memory>
-#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -29,33 +29,37 @@ namespace grid_base
 
 /**
  * @brief A* path finding algorithm.
+ * Logging is ExpansionLogging or NoLogging.
  *
  */
-class AStar : public IPlanningWithLogging
+template <typename Logging> class BasicAStar : public PlanningWithContext
 {
 public:
-  AStar(const double &heuristic_weight, const int search_space);
-  Path FindPath(const Node &start_node, const Node &goal_node,
-                const std::shared_ptr<Map> map) override;
-  Log GetLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    return log_;
-  }
-  void ClearLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.first.clear();
-    log_.second = nullptr;
-  }
+  BasicAStar(const double &heuristic_weight, const int search_space);
+  std::unique_ptr<PlanningContext> CreateContext() const override;
+  void Begin(const Node &start_node, const Node &goal_node,
+             const std::shared_ptr<Map> map,
+             PlanningContext &context) const override;
+  PlanningStatus Step(const std::size_t iterations,
+                      PlanningContext &context) const override;
 
 private:
-  Log log_{};
+  /**
+   * @brief Open list, a binary heap on f, and goal of one query.
+   *
+   */
+  class Context : public GridPlanningContext
+  {
+  public:
+    std::vector<std::shared_ptr<NodeParent>> open_list{};
+    Node goal_node{};
+  }; // class Context
 
   SearchSpace search_space_{};
   double heuristic_weight_{};
-  std::mutex log_mutex_{};
-}; // class AStar
+}; // class BasicAStar
+
+using AStar = BasicAStar<ExpansionLogging>;
 
 } // namespace grid_base
 
@@ -10,6 +10,7 @@
  */
 
 #include "bfs.h"
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
@@ -22,7 +23,8 @@ namespace planning
 namespace grid_base
 {
 
-BFS::BFS(const int search_space)
+template <typename Logging>
+BasicBFS<Logging>::BasicBFS(const int search_space)
 {
   if (search_space == 4)
     {
@@ -38,23 +40,74 @@ BFS::BFS(const int search_space)
     }
 }
 
-Path BFS::FindPath(const Node &start_node, const Node &goal_node,
-                   const std::shared_ptr<Map> map)
+template <typename Logging>
+std::unique_ptr<PlanningContext> BasicBFS<Logging>::CreateContext() const
 {
-  ClearLog();
+  return std::make_unique<Context>();
+}
 
-  std::shared_ptr<Map> map_copy = std::make_shared<Map>(*map);
-  map_copy->SetNodeState(goal_node, NodeState::kGoal);
+template <typename Logging>
+void BasicBFS<Logging>::Begin(const Node &start_node, const Node &goal_node,
+                              const std::shared_ptr<Map> map,
+                              PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  context.ClearLog();
+  context.open_list = {};
+  context.SetRunning();
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      std::cout << "No path found." << std::endl;
+      context.SetResult(Path{});
+      return;
+    }
+  context.goal_node = goal_node;
+  context.map->CopyCells(*map);
+  context.map->SetNodeState(goal_node, NodeState::kGoal);
+
+  context.open_list.push(
+      std::make_shared<NodeParent>(start_node, nullptr, Cost{}));
+  context.stats.nodes_generated = 1;
+  context.stats.allocations = 1;
+  context.stats.open_list_peak = 1;
+}
 
-  std::queue<std::shared_ptr<NodeParent>> search_list;
-  auto start_node_info =
-      std::make_shared<NodeParent>(start_node, nullptr, Cost{});
+template <typename Logging>
+PlanningStatus BasicBFS<Logging>::Step(const std::size_t iterations,
+                                       PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  if (context.GetStatus() != PlanningStatus::kRunning)
+    {
+      return context.GetStatus();
+    }
 
-  search_list.push(start_node_info);
+  PhaseTimer timer(context.stats.total_time);
 
-  while (!search_list.empty() &&
-         !IsGoal((search_list.front()->node), goal_node))
+  auto &stats{context.stats};
+  auto &search_list{context.open_list};
+  const auto &goal_node{context.goal_node};
+  const auto &map_copy{context.map};
+  for (std::size_t i = 0; i < iterations; i++)
     {
+      if (search_list.empty())
+        {
+          std::cout << "No path found." << std::endl;
+          return context.SetResult(Path{});
+        }
+      if (IsGoal(search_list.front()->node, goal_node))
+        {
+          auto current_node = search_list.front();
+          context.template SetGoalInLog<Logging>(current_node);
+          auto path = ReconstructPath(current_node);
+          map_copy->UpdateMapWithPath(path);
+          return context.SetResult(path);
+        }
+      if (context.ShouldStop())
+        {
+          return context.SetResult(Path{});
+        }
+
       auto current_node = search_list.front();
       search_list.pop();
 
@@ -63,10 +116,8 @@ Path BFS::FindPath(const Node &start_node, const Node &goal_node,
           continue;
         }
 
-      {
-        std::lock_guard<std::mutex> lock(log_mutex_);
-        log_.first.emplace_back(current_node);
-      }
+      context.template AddToLog<Logging>(current_node);
+      stats.nodes_expanded++;
       map_copy->SetNodeState(current_node->node, NodeState::kVisited);
 
       for (const auto &direction : search_space_)
@@ -79,25 +130,19 @@ Path BFS::FindPath(const Node &start_node, const Node &goal_node,
               continue;
             }
 
-          auto neighbor_node =
-              std::make_shared<NodeParent>(Node(x, y), current_node, Cost{});
-
-          search_list.push(neighbor_node);
+          search_list.push(
+              std::make_shared<NodeParent>(Node(x, y), current_node, Cost{}));
+          stats.nodes_generated++;
+          stats.allocations++;
         }
+      stats.open_list_peak =
+          std::max(stats.open_list_peak, search_list.size());
     }
-  if (search_list.empty())
-    {
-      std::cout << "No path found." << std::endl;
-      return Path{};
-    }
-
-  auto current_node = search_list.front();
-  log_.second = current_node;
-  auto path = ReconstructPath(current_node);
-  map_copy->UpdateMapWithPath(path);
-
-  return path;
+  return PlanningStatus::kRunning;
 }
 
+template class BasicBFS<ExpansionLogging>;
+template class BasicBFS<NoLogging>;
+
 } // namespace grid_base
 } // namespace planning
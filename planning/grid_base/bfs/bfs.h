@@ -14,8 +14,10 @@
 
 #include "utility/common_grid_base.h"
 #include "utility/i_planning.h"
+#include <cstddef>
 #include <cstdint>
-#include <mutex>
+#include <memory>
+#include <queue>
 #include <string>
 
 namespace planning
@@ -25,34 +27,38 @@ namespace grid_base
 
 /**
  * @brief Breadth First Search path finding algorithm.
+ * Logging is ExpansionLogging or NoLogging.
  *
  */
-class BFS : public IPlanningWithLogging
+template <typename Logging> class BasicBFS : public PlanningWithContext
 {
 
 public:
-  BFS(const int search_space);
-  Path FindPath(const Node &start_node, const Node &goal_node,
-                const std::shared_ptr<Map> map) override;
-  Log GetLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    return log_;
-  }
-  void ClearLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.first.clear();
-    log_.second = nullptr;
-  }
+  BasicBFS(const int search_space);
+  std::unique_ptr<PlanningContext> CreateContext() const override;
+  void Begin(const Node &start_node, const Node &goal_node,
+             const std::shared_ptr<Map> map,
+             PlanningContext &context) const override;
+  PlanningStatus Step(const std::size_t iterations,
+                      PlanningContext &context) const override;
 
 private:
-  Log log_{};
-  SearchSpace search_space_{};
+  /**
+   * @brief Open queue and goal of one query.
+   *
+   */
+  class Context : public GridPlanningContext
+  {
+  public:
+    std::queue<std::shared_ptr<NodeParent>> open_list{};
+    Node goal_node{};
+  }; // class Context
 
-  std::mutex log_mutex_{};
+  SearchSpace search_space_{};
 };
 
+using BFS = BasicBFS<ExpansionLogging>;
+
 } // namespace grid_base
 } // namespace planning
 
@@ -10,6 +10,7 @@
  */
 
 #include "dfs.h"
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -20,7 +21,8 @@ namespace planning
 namespace grid_base
 {
 
-DFS::DFS(const int search_space)
+template <typename Logging>
+BasicDFS<Logging>::BasicDFS(const int search_space)
 {
   if (search_space == 4)
     {
@@ -36,22 +38,74 @@ DFS::DFS(const int search_space)
     }
 }
 
-Path DFS::FindPath(const Node &start_node, const Node &goal_node,
-                   const std::shared_ptr<Map> map)
+template <typename Logging>
+std::unique_ptr<PlanningContext> BasicDFS<Logging>::CreateContext() const
 {
-  ClearLog();
+  return std::make_unique<Context>();
+}
 
-  std::shared_ptr<Map> map_copy = std::make_shared<Map>(*map);
-  map_copy->SetNodeState(goal_node, NodeState::kGoal);
+template <typename Logging>
+void BasicDFS<Logging>::Begin(const Node &start_node, const Node &goal_node,
+                              const std::shared_ptr<Map> map,
+                              PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  context.ClearLog();
+  context.open_list = {};
+  context.SetRunning();
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      std::cout << "No path found." << std::endl;
+      context.SetResult(Path{});
+      return;
+    }
+  context.goal_node = goal_node;
+  context.map->CopyCells(*map);
+  context.map->SetNodeState(goal_node, NodeState::kGoal);
+
+  context.open_list.push(
+      std::make_shared<NodeParent>(start_node, nullptr, Cost{}));
+  context.stats.nodes_generated = 1;
+  context.stats.allocations = 1;
+  context.stats.open_list_peak = 1;
+}
 
-  std::stack<std::shared_ptr<NodeParent>> search_list;
+template <typename Logging>
+PlanningStatus BasicDFS<Logging>::Step(const std::size_t iterations,
+                                       PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  if (context.GetStatus() != PlanningStatus::kRunning)
+    {
+      return context.GetStatus();
+    }
 
-  std::shared_ptr<NodeParent> start_node_info =
-      std::make_shared<NodeParent>(start_node, nullptr, Cost{});
-  search_list.push(start_node_info);
+  PhaseTimer timer(context.stats.total_time);
 
-  while (!search_list.empty() && !IsGoal(search_list.top()->node, goal_node))
+  auto &stats{context.stats};
+  auto &search_list{context.open_list};
+  const auto &goal_node{context.goal_node};
+  const auto &map_copy{context.map};
+  for (std::size_t i = 0; i < iterations; i++)
     {
+      if (search_list.empty())
+        {
+          std::cout << "No path found." << std::endl;
+          return context.SetResult(Path{});
+        }
+      if (IsGoal(search_list.top()->node, goal_node))
+        {
+          auto current_node = search_list.top();
+          context.template SetGoalInLog<Logging>(current_node);
+          auto path = ReconstructPath(current_node);
+          map_copy->UpdateMapWithPath(path);
+          return context.SetResult(path);
+        }
+      if (context.ShouldStop())
+        {
+          return context.SetResult(Path{});
+        }
+
       auto current_node = search_list.top();
       search_list.pop();
 
@@ -60,10 +114,8 @@ Path DFS::FindPath(const Node &start_node, const Node &goal_node,
           continue;
         }
 
-      {
-        std::lock_guard<std::mutex> lock(log_mutex_);
-        log_.first.emplace_back(current_node);
-      }
+      context.template AddToLog<Logging>(current_node);
+      stats.nodes_expanded++;
       map_copy->SetNodeState(current_node->node, NodeState::kVisited);
 
       for (const auto &direction : search_space_)
@@ -76,28 +128,19 @@ Path DFS::FindPath(const Node &start_node, const Node &goal_node,
               continue;
             }
 
-          std::shared_ptr<NodeParent> new_node_parent =
-              std::make_shared<NodeParent>(Node(x, y), current_node, Cost{});
-
-          search_list.push(new_node_parent);
+          search_list.push(
+              std::make_shared<NodeParent>(Node(x, y), current_node, Cost{}));
+          stats.nodes_generated++;
+          stats.allocations++;
         }
+      stats.open_list_peak =
+          std::max(stats.open_list_peak, search_list.size());
     }
-
-  if (search_list.empty())
-    {
-      std::cout << "No path found." << std::endl;
-      return Path{};
-    }
-
-  auto current_node = search_list.top();
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.second = current_node;
-  }
-  auto path = ReconstructPath(current_node);
-  map_copy->UpdateMapWithPath(path);
-  return path;
+  return PlanningStatus::kRunning;
 }
 
+template class BasicDFS<ExpansionLogging>;
+template class BasicDFS<NoLogging>;
+
 } // namespace grid_base
 } // namespace planning
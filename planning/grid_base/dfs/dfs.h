@@ -14,7 +14,8 @@
 
 #include "utility/common_grid_base.h"
 #include "utility/i_planning.h"
-#include <mutex>
+#include <cstddef>
+#include <memory>
 #include <stack>
 #include <string>
 
@@ -26,33 +27,37 @@ namespace grid_base
 
 /**
  * @brief Depth First Search algorithm.
+ * Logging is ExpansionLogging or NoLogging.
  *
  */
-class DFS : public IPlanningWithLogging
+template <typename Logging> class BasicDFS : public PlanningWithContext
 {
 public:
-  DFS(const int search_space);
-  Path FindPath(const Node &start_node, const Node &goal_node,
-                const std::shared_ptr<Map> map) override;
-  Log GetLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    return log_;
-  }
-  void ClearLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.first.clear();
-    log_.second = nullptr;
-  }
+  BasicDFS(const int search_space);
+  std::unique_ptr<PlanningContext> CreateContext() const override;
+  void Begin(const Node &start_node, const Node &goal_node,
+             const std::shared_ptr<Map> map,
+             PlanningContext &context) const override;
+  PlanningStatus Step(const std::size_t iterations,
+                      PlanningContext &context) const override;
 
 private:
-  Log log_{};
-  SearchSpace search_space_{};
+  /**
+   * @brief Open stack and goal of one query.
+   *
+   */
+  class Context : public GridPlanningContext
+  {
+  public:
+    std::stack<std::shared_ptr<NodeParent>> open_list{};
+    Node goal_node{};
+  }; // class Context
 
-  std::mutex log_mutex_{};
+  SearchSpace search_space_{};
 };
 
+using DFS = BasicDFS<ExpansionLogging>;
+
 } // namespace grid_base
 } // namespace planning
 
@@ -0,0 +1,348 @@
+/**
+ * @file flow_field.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "flow_field.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+namespace planning
+{
+namespace grid_base
+{
+
+namespace
+{
+constexpr double kInfinity{std::numeric_limits<double>::infinity()};
+constexpr double kEpsilon{1e-9};
+} // namespace
+
+FlowField::FlowField(const int search_space, const int tile_size)
+    : tile_size_(tile_size)
+{
+  if (search_space == 4)
+    {
+      search_space_ = GetFourDirection();
+    }
+  else if (search_space == 8)
+    {
+      search_space_ = GetEightDirection();
+    }
+  else
+    {
+      std::cout << "Invalid search space." << std::endl;
+    }
+
+  if (tile_size_ <= 0)
+    {
+      std::cout << "Invalid tile size." << std::endl;
+      tile_size_ = 16;
+    }
+
+  for (const auto &direction : search_space_)
+    {
+      step_costs_.emplace_back(std::hypot(direction[0], direction[1]));
+    }
+}
+
+void FlowField::Compute(const Node &goal_node, const std::shared_ptr<Map> map)
+{
+  stats_ = PlanningStats{};
+  PhaseTimer timer(stats_.total_time);
+  map_ = map;
+  goal_node_ = goal_node;
+  height_ = static_cast<int>(map_->GetHeight());
+  width_ = static_cast<int>(map_->GetWidth());
+
+  distance_.assign(height_ * width_, kInfinity);
+  directions_.assign(height_ * width_, Direction{0, 0});
+
+  tile_rows_ = (height_ + tile_size_ - 1) / tile_size_;
+  tile_cols_ = (width_ + tile_size_ - 1) / tile_size_;
+  tile_valid_.assign(tile_rows_ * tile_cols_, 0);
+
+  if (!IsPassable(goal_node_.x_, goal_node_.y_))
+    {
+      std::cout << "Goal is not free." << std::endl;
+      return;
+    }
+
+  DistanceQueue queue;
+  distance_[Index(goal_node_.x_, goal_node_.y_)] = 0.0;
+  queue.push({0.0, Index(goal_node_.x_, goal_node_.y_)});
+  stats_.nodes_generated++;
+  Propagate(queue);
+}
+
+void FlowField::UpdateCells(const std::vector<Node> &changed_nodes)
+{
+  if (map_ == nullptr)
+    {
+      return;
+    }
+  stats_ = PlanningStats{};
+  PhaseTimer timer(stats_.total_time);
+
+  // Raise: clear every cell whose shortest path went through a blocked cell.
+  std::queue<std::size_t> raise_queue;
+  std::vector<std::size_t> invalidated;
+  for (const auto &node : changed_nodes)
+    {
+      if (!IsInbound(node, map_))
+        {
+          continue;
+        }
+      auto index{Index(node.x_, node.y_)};
+      InvalidateTilesAround(node.x_, node.y_);
+      invalidated.emplace_back(index);
+      if (!IsPassable(node.x_, node.y_) && distance_[index] != kInfinity)
+        {
+          distance_[index] = kInfinity;
+          raise_queue.push(index);
+        }
+    }
+
+  while (!raise_queue.empty())
+    {
+      auto index{raise_queue.front()};
+      raise_queue.pop();
+      stats_.nodes_expanded++;
+      int x = index / width_;
+      int y = index % width_;
+
+      for (const auto &direction : search_space_)
+        {
+          int nx = x + direction[0];
+          int ny = y + direction[1];
+          if (!IsPassable(nx, ny) || distance_[Index(nx, ny)] == kInfinity ||
+              HasSupport(nx, ny))
+            {
+              continue;
+            }
+          distance_[Index(nx, ny)] = kInfinity;
+          InvalidateTilesAround(nx, ny);
+          invalidated.emplace_back(Index(nx, ny));
+          raise_queue.push(Index(nx, ny));
+        }
+    }
+
+  // Lower: seed the cleared and freed cells from their valid neighbors.
+  DistanceQueue queue;
+  for (const auto index : invalidated)
+    {
+      int x = index / width_;
+      int y = index % width_;
+      if (!IsPassable(x, y))
+        {
+          continue;
+        }
+      auto distance{IsGoal(Node(x, y), goal_node_)
+                        ? 0.0
+                        : BestNeighborDistance(x, y)};
+      if (distance < distance_[index])
+        {
+          distance_[index] = distance;
+          queue.push({distance, index});
+          stats_.nodes_generated++;
+        }
+    }
+  Propagate(queue);
+}
+
+void FlowField::UpdateTiles(const std::vector<Node> &agent_nodes)
+{
+  for (const auto &node : agent_nodes)
+    {
+      GetDirection(node);
+    }
+}
+
+FlowField::Direction FlowField::GetDirection(const Node &node)
+{
+  if (map_ == nullptr || !IsInbound(node, map_))
+    {
+      return Direction{0, 0};
+    }
+  auto tile_index{(node.x_ / tile_size_) * tile_cols_ + node.y_ / tile_size_};
+  if (!tile_valid_[tile_index])
+    {
+      ComputeTile(tile_index);
+    }
+  return directions_[Index(node.x_, node.y_)];
+}
+
+double FlowField::GetDistance(const Node &node) const
+{
+  if (map_ == nullptr || !IsInbound(node, map_))
+    {
+      return kInfinity;
+    }
+  return distance_[Index(node.x_, node.y_)];
+}
+
+Path FlowField::FollowFlow(const Node &start_node)
+{
+  if (GetDistance(start_node) == kInfinity)
+    {
+      return Path{};
+    }
+
+  Path path{start_node};
+  auto current_node{start_node};
+  while (!IsGoal(current_node, goal_node_))
+    {
+      auto direction{GetDirection(current_node)};
+      if ((direction[0] == 0 && direction[1] == 0) ||
+          path.size() > distance_.size())
+        {
+          return Path{};
+        }
+      current_node += Node(direction[0], direction[1]);
+      path.emplace_back(current_node);
+    }
+  return path;
+}
+
+std::size_t FlowField::GetComputedTileCount() const
+{
+  return std::count(tile_valid_.begin(), tile_valid_.end(), 1);
+}
+
+bool FlowField::IsPassable(int x, int y) const
+{
+  return x >= 0 && x < height_ && y >= 0 && y < width_ &&
+         map_->GetNodeState(Node(x, y)) != NodeState::kOccupied;
+}
+
+double FlowField::BestNeighborDistance(int x, int y) const
+{
+  auto best{kInfinity};
+  for (auto i = 0u; i < search_space_.size(); i++)
+    {
+      int nx = x + search_space_[i][0];
+      int ny = y + search_space_[i][1];
+      if (IsPassable(nx, ny))
+        {
+          best = std::min(best, distance_[Index(nx, ny)] + step_costs_[i]);
+        }
+    }
+  return best;
+}
+
+bool FlowField::HasSupport(int x, int y) const
+{
+  if (IsGoal(Node(x, y), goal_node_))
+    {
+      return true;
+    }
+  return std::abs(BestNeighborDistance(x, y) - distance_[Index(x, y)]) <
+         kEpsilon;
+}
+
+void FlowField::Propagate(DistanceQueue &queue)
+{
+  stats_.open_list_peak = std::max(stats_.open_list_peak, queue.size());
+  while (!queue.empty())
+    {
+      auto [distance, index] = queue.top();
+      queue.pop();
+      if (distance > distance_[index])
+        {
+          continue;
+        }
+      stats_.nodes_expanded++;
+      int x = index / width_;
+      int y = index % width_;
+
+      for (auto i = 0u; i < search_space_.size(); i++)
+        {
+          int nx = x + search_space_[i][0];
+          int ny = y + search_space_[i][1];
+          if (!IsPassable(nx, ny))
+            {
+              continue;
+            }
+          auto new_distance{distance + step_costs_[i]};
+          if (new_distance < distance_[Index(nx, ny)])
+            {
+              distance_[Index(nx, ny)] = new_distance;
+              InvalidateTilesAround(nx, ny);
+              queue.push({new_distance, Index(nx, ny)});
+              stats_.nodes_generated++;
+            }
+        }
+      stats_.open_list_peak = std::max(stats_.open_list_peak, queue.size());
+    }
+}
+
+void FlowField::InvalidateTilesAround(int x, int y)
+{
+  // Direction of a cell depends on its neighbors, which may lie in the
+  // adjacent tiles.
+  for (int dx = -1; dx <= 1; dx++)
+    {
+      for (int dy = -1; dy <= 1; dy++)
+        {
+          int nx = x + dx;
+          int ny = y + dy;
+          if (nx < 0 || nx >= height_ || ny < 0 || ny >= width_)
+            {
+              continue;
+            }
+          tile_valid_[(nx / tile_size_) * tile_cols_ + ny / tile_size_] = 0;
+        }
+    }
+}
+
+void FlowField::ComputeTile(std::size_t tile_index)
+{
+  int row_begin = (tile_index / tile_cols_) * tile_size_;
+  int col_begin = (tile_index % tile_cols_) * tile_size_;
+  int row_end = std::min(row_begin + tile_size_, height_);
+  int col_end = std::min(col_begin + tile_size_, width_);
+
+  for (int x = row_begin; x < row_end; x++)
+    {
+      for (int y = col_begin; y < col_end; y++)
+        {
+          auto &direction{directions_[Index(x, y)]};
+          direction = Direction{0, 0};
+          if (!IsPassable(x, y) || distance_[Index(x, y)] == kInfinity ||
+              IsGoal(Node(x, y), goal_node_))
+            {
+              continue;
+            }
+
+          auto best{kInfinity};
+          for (auto i = 0u; i < search_space_.size(); i++)
+            {
+              int nx = x + search_space_[i][0];
+              int ny = y + search_space_[i][1];
+              if (!IsPassable(nx, ny))
+                {
+                  continue;
+                }
+              auto distance{distance_[Index(nx, ny)] + step_costs_[i]};
+              if (distance < best)
+                {
+                  best = distance;
+                  direction = search_space_[i];
+                }
+            }
+        }
+    }
+  tile_valid_[tile_index] = 1;
+}
+
+} // namespace grid_base
+} // namespace planning
@@ -0,0 +1,139 @@
+/**
+ * @file flow_field.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Goal-centric distance field and tiled flow field for agents sharing
+ * a goal.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_GRID_BASE_FLOW_FIELD_FLOW_FIELD_H_
+#define PLANNING_GRID_BASE_FLOW_FIELD_FLOW_FIELD_H_
+
+#include "utility/common_grid_base.h"
+#include "utility/planning_stats.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <utility>
+#include <vector>
+
+namespace planning
+{
+namespace grid_base
+{
+
+/**
+ * @brief Flow field toward a single goal.
+ *
+ * The distance field is computed once for the whole map with Dijkstra from
+ * the goal. Movement directions are derived from it lazily, one tile at a
+ * time, so only the tiles agents actually stand on are computed. Map edits are
+ * repaired incrementally with UpdateCells instead of recomputing everything.
+ */
+class FlowField
+{
+public:
+  using Direction = std::array<int8_t, 2>;
+
+  FlowField(const int search_space, const int tile_size);
+
+  /**
+   * @brief Compute the distance field from goal node over the whole map.
+   * Invalidates every tile.
+   *
+   * @param goal_node Goal shared by all agents.
+   * @param map Map to compute the field on. Kept to repair later edits.
+   */
+  void Compute(const Node &goal_node, const std::shared_ptr<Map> map);
+
+  /**
+   * @brief Repair the distance field after the states of some cells changed on
+   * the map. Only the region whose distance depends on the changed cells is
+   * visited, and only the tiles around it are invalidated.
+   *
+   * @param changed_nodes Cells whose state changed since the last update.
+   */
+  void UpdateCells(const std::vector<Node> &changed_nodes);
+
+  /**
+   * @brief Compute the tiles agents stand on, if not computed yet.
+   *
+   * @param agent_nodes Positions of the agents.
+   */
+  void UpdateTiles(const std::vector<Node> &agent_nodes);
+
+  /**
+   * @brief Get the movement direction of a cell. Computes its tile on demand.
+   *
+   * @param node
+   * @return Direction {0, 0} on goal, occupied or unreachable cells.
+   */
+  Direction GetDirection(const Node &node);
+
+  /**
+   * @brief Get the distance of a cell to goal. Infinity if unreachable.
+   *
+   */
+  double GetDistance(const Node &node) const;
+
+  /**
+   * @brief Follow the flow from start node to goal.
+   *
+   * @param start_node
+   * @return Path Empty if goal is not reachable from start node.
+   */
+  Path FollowFlow(const Node &start_node);
+
+  std::size_t GetComputedTileCount() const;
+
+  /**
+   * @brief Counters and total time of the last Compute or UpdateCells call.
+   * Cleared and raised cells count as expanded too.
+   *
+   */
+  PlanningStats GetStats() const { return stats_; }
+
+private:
+  using DistanceQueue =
+      std::priority_queue<std::pair<double, std::size_t>,
+                          std::vector<std::pair<double, std::size_t>>,
+                          std::greater<std::pair<double, std::size_t>>>;
+
+  std::size_t Index(int x, int y) const { return x * width_ + y; }
+  bool IsPassable(int x, int y) const;
+  double BestNeighborDistance(int x, int y) const;
+  bool HasSupport(int x, int y) const;
+  void Propagate(DistanceQueue &queue);
+  void InvalidateTilesAround(int x, int y);
+  void ComputeTile(std::size_t tile_index);
+
+  SearchSpace search_space_{};
+  std::vector<double> step_costs_{};
+  int tile_size_{16};
+
+  std::shared_ptr<Map> map_{};
+  Node goal_node_{};
+  int height_{0};
+  int width_{0};
+  std::vector<double> distance_{};
+  std::vector<Direction> directions_{};
+
+  int tile_rows_{0};
+  int tile_cols_{0};
+  std::vector<uint8_t> tile_valid_{};
+
+  PlanningStats stats_{};
+}; // class FlowField
+
+} // namespace grid_base
+} // namespace planning
+
+#endif /* PLANNING_GRID_BASE_FLOW_FIELD_FLOW_FIELD_H_ */
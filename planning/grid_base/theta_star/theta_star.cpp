@@ -0,0 +1,234 @@
+/**
+ * @file theta_star.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "theta_star.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <queue>
+
+namespace planning
+{
+namespace grid_base
+{
+
+namespace
+{
+auto Compare{
+    [](std::shared_ptr<NodeParent> lhs, std::shared_ptr<NodeParent> rhs) {
+      return lhs->cost.f > rhs->cost.f;
+    }};
+} // namespace
+
+template <typename Logging>
+BasicThetaStar<Logging>::BasicThetaStar(const double &heuristic_weight,
+                                        const int search_space,
+                                        const bool lazy)
+    : heuristic_weight_(heuristic_weight), lazy_(lazy)
+{
+  if (search_space == 4)
+    {
+      search_space_ = GetFourDirection();
+    }
+  else if (search_space == 8)
+    {
+      search_space_ = GetEightDirection();
+    }
+  else
+    {
+      std::cout << "Invalid search space." << std::endl;
+    }
+}
+
+template <typename Logging>
+Path BasicThetaStar<Logging>::FindPath(const Node &start_node,
+                                       const Node &goal_node,
+                                       const std::shared_ptr<Map> map)
+{
+  query_stats_ = PlanningStats{};
+  Path path;
+  {
+    PhaseTimer timer(query_stats_.total_time);
+    path = Search(start_node, goal_node, map);
+  }
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  stats_ = query_stats_;
+  return path;
+}
+
+template <typename Logging>
+Path BasicThetaStar<Logging>::Search(const Node &start_node,
+                                     const Node &goal_node,
+                                     const std::shared_ptr<Map> map)
+{
+  ClearLog();
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      std::cout << "No path found." << std::endl;
+      return Path{};
+    }
+
+  std::shared_ptr<Map> map_copy = std::make_shared<Map>(*map);
+  map_copy->SetNodeState(goal_node, NodeState::kGoal);
+
+  // Best known node of every cell. Older entries left in the queue are stale.
+  const auto width{map_copy->GetWidth()};
+  std::vector<std::shared_ptr<NodeParent>> best_nodes(map_copy->GetHeight() *
+                                                      width);
+  auto best_node = [&](const Node &node) -> std::shared_ptr<NodeParent> & {
+    return best_nodes[node.x_ * width + node.y_];
+  };
+
+  std::priority_queue<std::shared_ptr<NodeParent>,
+                      std::vector<std::shared_ptr<NodeParent>>,
+                      decltype(Compare)>
+      search_list(Compare);
+
+  if (!IsFree(start_node, map_copy))
+    {
+      std::cout << "No path found." << std::endl;
+      return Path{};
+    }
+  auto start_node_info = std::make_shared<NodeParent>(
+      start_node, nullptr,
+      Cost(0, EuclideanDistance(start_node, goal_node), heuristic_weight_));
+  best_node(start_node) = start_node_info;
+  search_list.push(start_node_info);
+  query_stats_.nodes_generated = 1;
+  query_stats_.allocations = 1;
+  query_stats_.open_list_peak = 1;
+
+  std::shared_ptr<NodeParent> goal_node_info{};
+  while (!search_list.empty())
+    {
+      if (stop_condition_.ShouldStop())
+        {
+          return Path{};
+        }
+
+      auto current_node = search_list.top();
+      search_list.pop();
+
+      if (current_node != best_node(current_node->node) ||
+          !IsFree(current_node->node, map_copy))
+        {
+          continue;
+        }
+
+      // Lazy Theta*: the parent was assumed visible when this node was
+      // generated. Fall back to the best expanded neighbor if it is not.
+      if (lazy_ && current_node->parent != nullptr &&
+          !LineOfSight(current_node->parent->node, current_node->node,
+                       map_copy))
+        {
+          auto best_cost{std::numeric_limits<double>::max()};
+          for (const auto &direction : search_space_)
+            {
+              Node neighbor(current_node->node.x_ + direction[0],
+                            current_node->node.y_ + direction[1]);
+              if (!IsInbound(neighbor, map_copy) ||
+                  map_copy->GetNodeState(neighbor) != NodeState::kVisited)
+                {
+                  continue;
+                }
+              auto &neighbor_info = best_node(neighbor);
+              auto cost{neighbor_info->cost.g +
+                        EuclideanDistance(neighbor, current_node->node)};
+              if (cost < best_cost)
+                {
+                  best_cost = cost;
+                  current_node->parent = neighbor_info;
+                }
+            }
+          current_node->cost = Cost(best_cost, current_node->cost.h,
+                                    heuristic_weight_);
+        }
+
+      if (IsGoal(current_node->node, goal_node))
+        {
+          goal_node_info = current_node;
+          break;
+        }
+
+      if constexpr (Logging::kEnabled)
+        {
+          std::lock_guard<std::mutex> lock(log_mutex_);
+          log_.first.emplace_back(current_node);
+        }
+      query_stats_.nodes_expanded++;
+      map_copy->SetNodeState(current_node->node, NodeState::kVisited);
+
+      for (const auto &direction : search_space_)
+        {
+          Node neighbor(current_node->node.x_ + direction[0],
+                        current_node->node.y_ + direction[1]);
+          if (!IsFree(neighbor, map_copy))
+            {
+              continue;
+            }
+
+          // Path 2: connect to the grandparent if it is visible.
+          auto parent{current_node};
+          auto &grandparent{current_node->parent};
+          if (grandparent != nullptr &&
+              (lazy_ || LineOfSight(grandparent->node, neighbor, map_copy)))
+            {
+              parent = grandparent;
+            }
+          auto cost{parent->cost.g + EuclideanDistance(parent->node, neighbor)};
+
+          auto &neighbor_info = best_node(neighbor);
+          if (neighbor_info == nullptr || cost < neighbor_info->cost.g)
+            {
+              neighbor_info = std::make_shared<NodeParent>(
+                  neighbor, parent,
+                  Cost(cost, EuclideanDistance(neighbor, goal_node),
+                       heuristic_weight_));
+              search_list.push(neighbor_info);
+              query_stats_.nodes_generated++;
+              query_stats_.allocations++;
+            }
+        }
+      query_stats_.open_list_peak =
+          std::max(query_stats_.open_list_peak, search_list.size());
+    }
+
+  if (goal_node_info == nullptr)
+    {
+      std::cout << "No path found." << std::endl;
+      return Path{};
+    }
+
+  if constexpr (Logging::kEnabled)
+    {
+      std::lock_guard<std::mutex> lock(log_mutex_);
+      log_.second = goal_node_info;
+    }
+  return ReconstructPath(goal_node_info);
+}
+
+template <typename Logging>
+bool BasicThetaStar<Logging>::LineOfSight(const Node &node1, const Node &node2,
+                                          const std::shared_ptr<Map> map)
+{
+  query_stats_.collision_checks++;
+  PhaseTimer timer(query_stats_.collision_time);
+  return !CheckIfCollisionBetweenNodes(node1, node2, map);
+}
+
+template class BasicThetaStar<ExpansionLogging>;
+template class BasicThetaStar<NoLogging>;
+
+} // namespace grid_base
+} // namespace planning
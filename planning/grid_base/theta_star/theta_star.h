@@ -0,0 +1,102 @@
+/**
+ * @file theta_star.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Theta* and Lazy Theta* any-angle path finding algorithms.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_GRID_BASE_THETA_STAR_THETA_STAR_H_
+#define PLANNING_GRID_BASE_THETA_STAR_THETA_STAR_H_
+
+#include "utility/common_grid_base.h"
+#include "utility/i_planning.h"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace planning
+{
+
+namespace grid_base
+{
+
+/**
+ * @brief Theta* any-angle path finding algorithm.
+ *
+ * Works like A* but lets a node inherit the parent of the node it is expanded
+ * from when they see each other, so paths are not bound to grid directions.
+ * In lazy mode line of sight is assumed when a node is generated and only
+ * verified once it is expanded, which skips the checks of nodes that are never
+ * expanded. A query stopped through FindPathAsync returns an empty path.
+ * Logging is ExpansionLogging or NoLogging.
+ */
+template <typename Logging> class BasicThetaStar : public IPlanningWithLogging
+{
+public:
+  BasicThetaStar(const double &heuristic_weight, const int search_space,
+                 const bool lazy);
+  Path FindPath(const Node &start_node, const Node &goal_node,
+                const std::shared_ptr<Map> map) override;
+  Log GetLog() override
+  {
+    LogLock<Logging> lock(log_mutex_);
+    return log_;
+  }
+  void ClearLog() override
+  {
+    LogLock<Logging> lock(log_mutex_);
+    log_.first.clear();
+    log_.second = nullptr;
+  }
+
+  /**
+   * @brief Line of sight checks done by the last FindPath call.
+   *
+   */
+  std::size_t GetLineOfSightCheckCount() const
+  {
+    return GetStats().collision_checks;
+  }
+  PlanningStats GetStats() const override
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+  }
+
+private:
+  /**
+   * @brief The query of FindPath, counting into query stats.
+   *
+   */
+  Path Search(const Node &start_node, const Node &goal_node,
+              const std::shared_ptr<Map> map);
+  bool LineOfSight(const Node &node1, const Node &node2,
+                   const std::shared_ptr<Map> map);
+
+  // Stays empty with NoLogging.
+  Log log_{};
+
+  SearchSpace search_space_{};
+  double heuristic_weight_{};
+  bool lazy_{false};
+  // Only the query thread counts into query stats. They are published to
+  // stats, guarded by stats_mutex_, once the query ends.
+  PlanningStats query_stats_{};
+  PlanningStats stats_{};
+  mutable std::mutex stats_mutex_{};
+  std::mutex log_mutex_{};
+}; // class BasicThetaStar
+
+using ThetaStar = BasicThetaStar<ExpansionLogging>;
+
+} // namespace grid_base
+
+} // namespace planning
+
+#endif /* PLANNING_GRID_BASE_THETA_STAR_THETA_STAR_H_ */
@@ -0,0 +1,357 @@
+/**
+ * @file fmt_star.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "fmt_star.h"
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace planning
+{
+namespace tree_base
+{
+
+namespace
+{
+
+constexpr std::size_t kStart{0};
+constexpr std::size_t kGoal{1};
+
+} // namespace
+
+template <typename Logging>
+Path BasicFMTStar<Logging>::FindPath(const Node &start_node,
+                                     const Node &goal_node,
+                                     const std::shared_ptr<Map> map)
+{
+  query_stats_ = PlanningStats{};
+  Path path;
+  {
+    PhaseTimer timer(query_stats_.total_time);
+    path = Search(start_node, goal_node, map);
+  }
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  stats_ = query_stats_;
+  return path;
+}
+
+template <typename Logging>
+Path BasicFMTStar<Logging>::Search(const Node &start_node,
+                                   const Node &goal_node,
+                                   const std::shared_ptr<Map> map)
+{
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      ClearLog();
+      return Path();
+    }
+
+  Sampler sampler(seed_);
+  sampler.SetMap(map);
+  if (sampler.GetFreeNodeCount() == 0)
+    {
+      ClearLog();
+      return Path();
+    }
+  Graph graph(neighbor_radius_, map->GetHeight(), map->GetWidth());
+  std::vector<Node> batch{start_node, goal_node};
+  AddSamples(batch, graph);
+  {
+    LogLock<Logging> lock(log_mutex_);
+    tree_.Clear();
+    tree_.Reserve(max_sample_count_ + 2);
+    goal_index_ = kInvalidNodeIndex;
+    graph.tree_indices[kStart] =
+        tree_.AddNode(start_node, kInvalidNodeIndex, Cost{});
+  }
+  query_stats_.nodes_generated = 1;
+  graph.reopened.push_back(kStart);
+
+  for (auto sample_count = 0; sample_count < max_sample_count_;
+       sample_count += batch_size_)
+    {
+      const auto count{std::min(batch_size_, max_sample_count_ - sample_count)};
+      const auto goal_cost{GoalCost(graph)};
+      PhaseClock clock;
+      if (goal_cost == std::numeric_limits<double>::max())
+        {
+          sampler.FreeNodes(count, batch);
+        }
+      else
+        {
+          // Edges are at most neighbor radius long and add 1 to g, so a
+          // path of length d costs at least d * (1 + 1 / radius).
+          const auto diameter{goal_cost * neighbor_radius_ /
+                              (neighbor_radius_ + 1.0)};
+          batch.clear();
+          for (auto i = 0; i < count; i++)
+            {
+              batch.emplace_back(
+                  sampler.InformedNode(start_node, goal_node, diameter));
+            }
+        }
+      clock.Lap(query_stats_.sampling_time);
+      graph.batch_tree_size = tree_.Size();
+      AddSamples(batch, graph);
+      if (!March(graph, map))
+        {
+          break;
+        }
+    }
+
+  LogLock<Logging> lock(log_mutex_);
+  return tree_.ReconstructPath(goal_index_);
+}
+
+template <typename Logging> Log BasicFMTStar<Logging>::GetLog()
+{
+  if constexpr (!Logging::kEnabled)
+    {
+      return Log{};
+    }
+  LogLock<Logging> lock(log_mutex_);
+  Log log{tree_.ToNodeParents(), nullptr};
+  if (goal_index_ != kInvalidNodeIndex)
+    {
+      log.second = log.first[goal_index_];
+    }
+  return log;
+}
+
+template <typename Logging>
+void BasicFMTStar<Logging>::AddSamples(const std::vector<Node> &batch,
+                                       Graph &graph)
+{
+  PhaseTimer timer(query_stats_.nearest_neighbor_time);
+  query_stats_.neighbor_queries += batch.size();
+  for (const auto &node : batch)
+    {
+      const auto sample{graph.samples.size()};
+      graph.samples.emplace_back(node);
+      graph.states.emplace_back(SampleState::kUnvisited);
+      graph.tree_indices.emplace_back(kInvalidNodeIndex);
+      graph.spatial_hash_grid.Insert(node, sample);
+      graph.neighbors.emplace_back();
+      graph.spatial_hash_grid.Radius(node, neighbor_radius_,
+                                     graph.neighbors[sample]);
+
+      // Tree nodes next to a new sample are expanded again to reach it.
+      for (const auto neighbor : graph.neighbors[sample])
+        {
+          if (neighbor == sample)
+            {
+              continue;
+            }
+          graph.neighbors[neighbor].emplace_back(sample);
+          if (graph.states[neighbor] != SampleState::kUnvisited)
+            {
+              graph.reopened.emplace_back(neighbor);
+            }
+        }
+    }
+}
+
+template <typename Logging>
+bool BasicFMTStar<Logging>::March(Graph &graph, const std::shared_ptr<Map> map)
+{
+  auto &states{graph.states};
+  auto &tree_indices{graph.tree_indices};
+  const auto &samples{graph.samples};
+
+  // Entries are not removed when a key drops, stale ones are pushed again
+  // with the current key.
+  using OpenEntry = std::pair<double, std::size_t>;
+  std::priority_queue<OpenEntry, std::vector<OpenEntry>,
+                      std::greater<OpenEntry>>
+      open;
+  for (const auto sample : graph.reopened)
+    {
+      states[sample] = SampleState::kOpen;
+      open.emplace(Key(graph, sample), sample);
+    }
+  graph.reopened.clear();
+  query_stats_.open_list_peak =
+      std::max(query_stats_.open_list_peak, open.size());
+
+  std::vector<std::size_t> new_open;
+  while (!open.empty())
+    {
+      if (stop_condition_.ShouldStop())
+        {
+          return false;
+        }
+
+      const auto [key, current] = open.top();
+      open.pop();
+      if (states[current] != SampleState::kOpen)
+        {
+          continue;
+        }
+      if (key != Key(graph, current))
+        {
+          open.emplace(Key(graph, current), current);
+          continue;
+        }
+      // Nodes left open cannot improve the goal. They are expanded again
+      // when a later batch adds a sample next to them.
+      if (key >= GoalCost(graph))
+        {
+          break;
+        }
+      query_stats_.nodes_expanded++;
+
+      new_open.clear();
+      const auto current_cost{tree_.GetCost(tree_indices[current])};
+      for (const auto next : graph.neighbors[current])
+        {
+          // Tree nodes of earlier batches move below cheaper new nodes.
+          if (states[next] != SampleState::kUnvisited)
+            {
+              if (tree_indices[next] < graph.batch_tree_size &&
+                  current_cost.f + 1 +
+                          EuclideanDistance(samples[current], samples[next]) <
+                      tree_.GetCost(tree_indices[next]).f &&
+                  IsEdgeFree(current, next, graph, map))
+                {
+                  Rewire(current, next, graph);
+                  new_open.emplace_back(next);
+                }
+              continue;
+            }
+
+          // Connect to the cheapest open neighbor, current is one of them.
+          auto parent{current};
+          auto parent_cost{std::numeric_limits<double>::max()};
+          for (const auto candidate : graph.neighbors[next])
+            {
+              if (states[candidate] != SampleState::kOpen)
+                {
+                  continue;
+                }
+              auto cost{tree_.GetCost(tree_indices[candidate]).f + 1 +
+                        EuclideanDistance(samples[candidate], samples[next])};
+              if (cost < parent_cost)
+                {
+                  parent_cost = cost;
+                  parent = candidate;
+                }
+            }
+          if (!IsEdgeFree(parent, next, graph, map))
+            {
+              continue;
+            }
+
+          const auto cost{tree_.GetCost(tree_indices[parent])};
+          auto next_cost{
+              Cost(cost.g + 1,
+                   cost.h + EuclideanDistance(samples[parent], samples[next]))};
+          LogLock<Logging> lock(log_mutex_);
+          tree_indices[next] =
+              tree_.AddNode(samples[next], tree_indices[parent], next_cost);
+          if (next == kGoal)
+            {
+              goal_index_ = tree_indices[next];
+            }
+          query_stats_.nodes_generated++;
+          new_open.emplace_back(next);
+        }
+
+      // New nodes become parents only after current is expanded.
+      states[current] = SampleState::kClosed;
+      for (const auto sample : new_open)
+        {
+          states[sample] = SampleState::kOpen;
+          open.emplace(Key(graph, sample), sample);
+        }
+      query_stats_.open_list_peak =
+          std::max(query_stats_.open_list_peak, open.size());
+    }
+  return true;
+}
+
+template <typename Logging>
+bool BasicFMTStar<Logging>::IsEdgeFree(const std::size_t parent,
+                                       const std::size_t child, Graph &graph,
+                                       const std::shared_ptr<Map> map)
+{
+  const auto key{(static_cast<std::uint64_t>(parent) << 32) | child};
+  const auto [edge, is_new] = graph.checked_edges.try_emplace(key, false);
+  if (is_new)
+    {
+      query_stats_.collision_checks++;
+      PhaseTimer timer(query_stats_.collision_time);
+      edge->second = !CheckIfCollisionBetweenNodes(
+          graph.samples[parent], graph.samples[child], map);
+    }
+  return edge->second;
+}
+
+template <typename Logging>
+void BasicFMTStar<Logging>::Rewire(const std::size_t parent,
+                                   const std::size_t child, Graph &graph)
+{
+  PhaseTimer timer(query_stats_.rewire_time);
+  LogLock<Logging> lock(log_mutex_);
+  tree_.SetParent(graph.tree_indices[child], graph.tree_indices[parent]);
+
+  // Descendants get cheaper by the same amount, set them top-down.
+  auto &update_stack{graph.update_stack};
+  update_stack.clear();
+  update_stack.push_back(graph.tree_indices[child]);
+  while (!update_stack.empty())
+    {
+      const auto index{update_stack.back()};
+      update_stack.pop_back();
+      const auto node{tree_.GetNode(index)};
+      const auto parent_index{tree_.GetParent(index)};
+      const auto &parent_cost{tree_.GetCost(parent_index)};
+      tree_.SetCost(index,
+                    Cost(parent_cost.g + 1,
+                         parent_cost.h +
+                             EuclideanDistance(node,
+                                               tree_.GetNode(parent_index))));
+      for (auto next = tree_.GetFirstChild(index); next != kInvalidNodeIndex;
+           next = tree_.GetNextSibling(next))
+        {
+          update_stack.push_back(next);
+        }
+    }
+}
+
+template <typename Logging>
+double BasicFMTStar<Logging>::Key(const Graph &graph,
+                                  const std::size_t sample) const
+{
+  // Every edge is at most neighbor radius long and adds 1 to g, so the
+  // remaining cost is at least distance * (1 + 1 / radius).
+  return tree_.GetCost(graph.tree_indices[sample]).f +
+         EuclideanDistance(graph.samples[sample], graph.samples[kGoal]) *
+             (1.0 + 1.0 / neighbor_radius_);
+}
+
+template <typename Logging>
+double BasicFMTStar<Logging>::GoalCost(const Graph &graph) const
+{
+  if (graph.tree_indices[kGoal] == kInvalidNodeIndex)
+    {
+      return std::numeric_limits<double>::max();
+    }
+  return tree_.GetCost(graph.tree_indices[kGoal]).f;
+}
+
+template class BasicFMTStar<ExpansionLogging>;
+template class BasicFMTStar<NoLogging>;
+
+} // namespace tree_base
+} // namespace planning
@@ -0,0 +1,169 @@
+/**
+ * @file fmt_star.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Fast Marching Tree (FMT*) algorithm.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_TREE_BASE_FMT_STAR_FMT_STAR_H_
+#define PLANNING_TREE_BASE_FMT_STAR_FMT_STAR_H_
+
+#include "utility/common_tree_base.h"
+#include "utility/i_planning.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace planning
+{
+namespace tree_base
+{
+
+/**
+ * @brief Fast Marching Tree over batches of free samples.
+ *
+ * Grows the tree outward from the start in order of cost plus an admissible
+ * heuristic to the goal. An unvisited sample is connected only to its
+ * cheapest open neighbor and only that edge is collision checked, so edges
+ * that cannot be part of the tree are never checked.
+ *
+ * The tree and every checked edge are kept across batches, like BIT*. Each
+ * batch reopens the tree nodes next to its samples and marches on from them,
+ * rewiring tree nodes of earlier batches through cheaper new nodes. Once the
+ * goal is reached, samples are drawn from the ellipse of nodes that could
+ * still improve it and nodes that cannot are not expanded. Batches run until
+ * the sample budget is used. A query stopped through FindPathAsync returns
+ * the best path found so far.
+ *
+ * Logging is ExpansionLogging or NoLogging. With NoLogging the tree is only
+ * kept for the search and GetLog is empty.
+ */
+template <typename Logging> class BasicFMTStar : public IPlanningWithLogging
+{
+public:
+  BasicFMTStar() {}
+  BasicFMTStar(const int max_sample_count, const int batch_size,
+               const int neighbor_radius)
+      : max_sample_count_(max_sample_count), batch_size_(batch_size),
+        neighbor_radius_(neighbor_radius)
+  {
+  }
+  ~BasicFMTStar() {}
+  Path FindPath(const Node &start_node, const Node &goal_node,
+                const std::shared_ptr<Map> map) override;
+  Log GetLog() override;
+  void ClearLog() override
+  {
+    LogLock<Logging> lock(log_mutex_);
+    tree_.Clear();
+    goal_index_ = kInvalidNodeIndex;
+  }
+
+  /**
+   * @brief Seed of the sampler. Every FindPath call restarts from this seed.
+   *
+   */
+  void SetSeed(const std::uint64_t seed) { seed_ = seed; }
+
+  /**
+   * @brief Collision checks done by the last FindPath call.
+   *
+   */
+  std::size_t GetCollisionCheckCount() const
+  {
+    return GetStats().collision_checks;
+  }
+  PlanningStats GetStats() const override
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+  }
+
+private:
+  enum class SampleState : std::uint8_t
+  {
+    kUnvisited,
+    kOpen,
+    kClosed
+  };
+
+  /**
+   * @brief Samples, their neighbors and checked edges of one query, kept
+   * across batches. The first sample is the start, the second the goal.
+   *
+   */
+  struct Graph
+  {
+    Graph(const double neighbor_radius, const std::size_t height,
+          const std::size_t width)
+        : spatial_hash_grid(neighbor_radius, height, width)
+    {
+    }
+
+    SpatialHashGrid spatial_hash_grid;
+    std::vector<Node> samples{};
+    std::vector<std::vector<std::size_t>> neighbors{};
+    std::vector<SampleState> states{};
+    std::vector<NodeIndex> tree_indices{};
+    // Tree nodes to expand at the start of the next march.
+    std::vector<std::size_t> reopened{};
+    // Tree size before the batch, only older nodes are rewired.
+    std::size_t batch_tree_size{0};
+    // Collision free flag per parent and child sample pair.
+    std::unordered_map<std::uint64_t, bool> checked_edges{};
+    std::vector<NodeIndex> update_stack{};
+  }; // struct Graph
+
+  /**
+   * @brief The query of FindPath, counting into query stats.
+   *
+   */
+  Path Search(const Node &start_node, const Node &goal_node,
+              const std::shared_ptr<Map> map);
+  void AddSamples(const std::vector<Node> &batch, Graph &graph);
+
+  /**
+   * @brief March the wavefront from the reopened nodes until it runs out or
+   * no open node can improve the goal.
+   *
+   * @return false if the query was stopped.
+   */
+  bool March(Graph &graph, const std::shared_ptr<Map> map);
+  bool IsEdgeFree(const std::size_t parent, const std::size_t child,
+                  Graph &graph, const std::shared_ptr<Map> map);
+  void Rewire(const std::size_t parent, const std::size_t child,
+              Graph &graph);
+  double Key(const Graph &graph, const std::size_t sample) const;
+  double GoalCost(const Graph &graph) const;
+
+  // Tree of the last query, guarded by log_mutex_ for GetLog.
+  Tree tree_{};
+  NodeIndex goal_index_{kInvalidNodeIndex};
+
+  int max_sample_count_{10000};
+  int batch_size_{2000};
+  int neighbor_radius_{15};
+  // Only the query thread counts into query stats. They are published to
+  // stats, guarded by stats_mutex_, once the query ends.
+  PlanningStats query_stats_{};
+  PlanningStats stats_{};
+  mutable std::mutex stats_mutex_;
+  std::uint64_t seed_{std::random_device{}()};
+  std::mutex log_mutex_;
+};
+
+using FMTStar = BasicFMTStar<ExpansionLogging>;
+
+} // namespace tree_base
+} // namespace planning
+
+#endif /* PLANNING_TREE_BASE_FMT_STAR_FMT_STAR_H_ */
@@ -0,0 +1,279 @@
+/**
+ * @file parallel_rrt_star.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "parallel_rrt_star.h"
+
+#include <algorithm>
+
+namespace planning
+{
+namespace tree_base
+{
+
+Path ParallelRRTStar::FindPath(const Node &start_node, const Node &goal_node,
+                               const std::shared_ptr<Map> map)
+{
+  PlanningStats stats;
+  Path path;
+  {
+    PhaseTimer timer(stats.total_time);
+    path = Search(start_node, goal_node, map, stats);
+  }
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  stats_ = stats;
+  return path;
+}
+
+Path ParallelRRTStar::Search(const Node &start_node, const Node &goal_node,
+                             const std::shared_ptr<Map> map,
+                             PlanningStats &stats)
+{
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      ClearLog();
+      return Path();
+    }
+
+  Sampler sampler(seed_);
+  sampler.SetMap(map);
+  if (sampler.GetFreeNodeCount() == 0)
+    {
+      ClearLog();
+      return Path();
+    }
+  ConcurrentSpatialHashGrid spatial_hash_grid(
+      neighbor_radius_, map->GetHeight(), map->GetWidth());
+  spatial_hash_grid.Insert(start_node, 0);
+  // Each iteration adds at most a node and a goal node.
+  auto tree{std::make_shared<ConcurrentTree>(
+      2 * static_cast<std::size_t>(max_iteration_) + 1)};
+  tree->AddNode(start_node, kInvalidNodeIndex);
+  stats.nodes_generated = 1;
+  goal_index_ = kInvalidNodeIndex;
+  std::atomic_store(&tree_, tree);
+  iteration_ = 0;
+
+  // Workers share the free cell index, each with its own generator and
+  // stats.
+  std::vector<PlanningStats> worker_stats(thread_count_);
+  std::vector<std::thread> workers;
+  for (auto i = 1u; i < thread_count_; i++)
+    {
+      auto worker_sampler{sampler};
+      worker_sampler.GetGenerator().Seed(seed_ + i);
+      workers.emplace_back(&ParallelRRTStar::Work, this,
+                           std::move(worker_sampler), std::cref(goal_node),
+                           std::ref(spatial_hash_grid), std::ref(*tree), map,
+                           std::ref(worker_stats[i]));
+    }
+  Work(std::move(sampler), goal_node, spatial_hash_grid, *tree, map,
+       worker_stats[0]);
+  for (auto &worker : workers)
+    {
+      worker.join();
+    }
+  for (const auto &worker : worker_stats)
+    {
+      stats += worker;
+    }
+
+  return tree->ReconstructPath(goal_index_);
+}
+
+Log ParallelRRTStar::GetLog()
+{
+  const auto tree{std::atomic_load(&tree_)};
+  Log log{tree->ToNodeParents(), nullptr};
+  const auto goal_index{goal_index_.load()};
+  if (goal_index < log.first.size())
+    {
+      log.second = log.first[goal_index];
+    }
+  return log;
+}
+
+void ParallelRRTStar::ClearLog()
+{
+  goal_index_ = kInvalidNodeIndex;
+  std::atomic_store(&tree_, std::make_shared<ConcurrentTree>(0));
+}
+
+void ParallelRRTStar::Work(Sampler sampler, const Node &goal_node,
+                           ConcurrentSpatialHashGrid &spatial_hash_grid,
+                           ConcurrentTree &tree, const std::shared_ptr<Map> map,
+                           PlanningStats &stats)
+{
+  std::vector<ConcurrentSpatialHashGrid::Entry> neighbors;
+  std::vector<std::pair<double, std::size_t>> order;
+  std::vector<Cost> neighbor_costs;
+  std::vector<NodeIndex> update_stack;
+  ConcurrentSpatialHashGrid::Entry steer;
+  Node new_node;
+  // Each worker checks its own copy.
+  auto stop_condition{stop_condition_};
+  PhaseClock clock;
+  while (iteration_++ < max_iteration_ && !stop_condition.ShouldStop())
+    {
+      // Steer from the closest node around the sample that can be wired to
+      // it, like RRTStar falls back to other neighbors.
+      stats.nodes_expanded++;
+      clock.Restart();
+      auto random_node{sampler.FreeNode()};
+      clock.Lap(stats.sampling_time);
+      spatial_hash_grid.Radius(random_node, neighbor_radius_, neighbors);
+      stats.neighbor_queries++;
+      if (neighbors.empty() && spatial_hash_grid.Nearest(random_node, steer))
+        {
+          neighbors.emplace_back(steer);
+        }
+      order.clear();
+      for (auto i = 0u; i < neighbors.size(); i++)
+        {
+          order.emplace_back(EuclideanDistance(neighbors[i].node, random_node),
+                             i);
+        }
+      std::sort(order.begin(), order.end());
+      clock.Lap(stats.nearest_neighbor_time);
+      auto is_wired{false};
+      for (const auto &[distance, i] : order)
+        {
+          // Steering only fails, without a ray cast, below min branch length.
+          stats.collision_checks += distance >= min_branch_length_;
+          if (WireNewNode(max_branch_length_, min_branch_length_, random_node,
+                          neighbors[i].node, map, new_node))
+            {
+              steer = neighbors[i];
+              is_wired = true;
+              break;
+            }
+        }
+      clock.Lap(stats.collision_time);
+      if (!is_wired)
+        {
+          continue;
+        }
+
+      // Steering node is always a candidate, WireNewNode checked its edge.
+      spatial_hash_grid.Radius(new_node, neighbor_radius_, neighbors);
+      stats.neighbor_queries++;
+      auto steer_position{static_cast<std::size_t>(
+          std::find_if(neighbors.begin(), neighbors.end(),
+                       [&steer](const ConcurrentSpatialHashGrid::Entry &entry) {
+                         return entry.id == steer.id;
+                       }) -
+          neighbors.begin())};
+      if (steer_position == neighbors.size())
+        {
+          neighbors.emplace_back(steer);
+        }
+      neighbor_costs.clear();
+      for (const auto &neighbor : neighbors)
+        {
+          neighbor_costs.emplace_back(tree.GetCost(neighbor.id));
+        }
+      clock.Lap(stats.nearest_neighbor_time);
+
+      // Cheaper parents than the steering node are cast from the parent to
+      // the new node in cost order until one is visible. Costs can drop
+      // meanwhile, the tree computes the cost through the chosen parent.
+      order.clear();
+      for (auto i = 0u; i < neighbors.size(); i++)
+        {
+          order.emplace_back(neighbor_costs[i].f + 1 +
+                                 EuclideanDistance(new_node, neighbors[i].node),
+                             i);
+        }
+      const auto steer_cost{order[steer_position].first};
+      auto parent{steer_position};
+      std::sort(order.begin(), order.end());
+      for (const auto &[cost, i] : order)
+        {
+          if (cost >= steer_cost)
+            {
+              break;
+            }
+          stats.collision_checks++;
+          if (!CheckIfCollisionBetweenNodes(neighbors[i].node, new_node, map))
+            {
+              parent = i;
+              break;
+            }
+        }
+      clock.Lap(stats.collision_time);
+      const auto new_index{tree.AddNode(new_node, neighbors[parent].id)};
+      if (new_index == kInvalidNodeIndex)
+        {
+          break;
+        }
+      stats.nodes_generated++;
+      spatial_hash_grid.Insert(new_node, new_index);
+      clock.Lap(stats.nearest_neighbor_time);
+
+      // Rewire the neighbors the new node improves, casting from the new node
+      // to its new child. Rewire compares against the current cost, so a
+      // neighbor that got cheaper meanwhile is left alone.
+      const auto new_cost{tree.GetCost(new_index).f};
+      for (auto i = 0u; i < neighbors.size(); i++)
+        {
+          if (i == parent ||
+              new_cost + 1 + EuclideanDistance(new_node, neighbors[i].node) >=
+                  neighbor_costs[i].f)
+            {
+              continue;
+            }
+          stats.collision_checks++;
+          if (!CheckIfCollisionBetweenNodes(new_node, neighbors[i].node,
+                                            map) &&
+              tree.Rewire(neighbors[i].id, new_index))
+            {
+              tree.UpdateCosts(neighbors[i].id, update_stack);
+            }
+        }
+      clock.Lap(stats.rewire_time);
+      UpdateGoal(new_index, goal_node, tree, stats);
+    }
+}
+
+void ParallelRRTStar::UpdateGoal(const NodeIndex new_index,
+                                 const Node &goal_node, ConcurrentTree &tree,
+                                 PlanningStats &stats)
+{
+  const auto remaining_distance{
+      EuclideanDistance(tree.GetNode(new_index), goal_node)};
+  if (remaining_distance >= goal_radius_)
+    {
+      return;
+    }
+  auto goal_index{goal_index_.load()};
+  const auto new_cost{tree.GetCost(new_index).f + 1 + remaining_distance};
+  if (goal_index != kInvalidNodeIndex &&
+      new_cost >= tree.GetCost(goal_index).f)
+    {
+      return;
+    }
+  const auto index{tree.AddNode(goal_node, new_index)};
+  if (index == kInvalidNodeIndex)
+    {
+      return;
+    }
+  stats.nodes_generated++;
+
+  // Another worker can publish a cheaper goal in between.
+  const auto cost{tree.GetCost(index).f};
+  while ((goal_index == kInvalidNodeIndex ||
+          cost < tree.GetCost(goal_index).f) &&
+         !goal_index_.compare_exchange_weak(goal_index, index))
+    {
+    }
+}
+
+} // namespace tree_base
+} // namespace planning
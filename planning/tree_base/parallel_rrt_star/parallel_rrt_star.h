@@ -0,0 +1,124 @@
+/**
+ * @file parallel_rrt_star.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Multi-threaded RRT* algorithm.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_TREE_BASE_PARALLEL_RRT_STAR_PARALLEL_RRT_STAR_H_
+#define PLANNING_TREE_BASE_PARALLEL_RRT_STAR_PARALLEL_RRT_STAR_H_
+
+#include "utility/common_tree_base.h"
+#include "utility/concurrent_spatial_hash_grid.h"
+#include "utility/concurrent_tree.h"
+#include "utility/i_planning.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace planning
+{
+namespace tree_base
+{
+
+/**
+ * @brief RRT* with worker threads sharing one tree. Sampling, steering,
+ * neighbor search and every collision check run in parallel against a
+ * concurrent spatial hash that stores node positions. The tree locks one node
+ * at a time, so adding, rewiring and cost propagation only wait for threads
+ * touching the same nodes. Results depend on thread timing, so a seed does
+ * not reproduce a run when more than one thread is used. A query stopped
+ * through FindPathAsync returns the best path found so far.
+ */
+class ParallelRRTStar : public IPlanningWithLogging
+{
+public:
+  ParallelRRTStar() {}
+  ParallelRRTStar(const int max_iteration, const int max_branch_length,
+                  const int min_branch_length, const int neighbor_radius,
+                  const int goal_radius, const unsigned int thread_count)
+      : max_iteration_(max_iteration), max_branch_length_(max_branch_length),
+        min_branch_length_(min_branch_length),
+        neighbor_radius_(neighbor_radius), goal_radius_(goal_radius),
+        thread_count_(thread_count > 0
+                          ? thread_count
+                          : std::max(std::thread::hardware_concurrency(), 1u))
+  {
+  }
+  ~ParallelRRTStar() {}
+  Path FindPath(const Node &start_node, const Node &goal_node,
+                const std::shared_ptr<Map> map) override;
+  Log GetLog() override;
+  void ClearLog() override;
+
+  /**
+   * @brief Seed of the samplers, worker i uses seed + i.
+   *
+   */
+  void SetSeed(const std::uint64_t seed) { seed_ = seed; }
+
+  /**
+   * @brief Stats of the last query. Counters and phase times are added up
+   * over the workers.
+   *
+   */
+  PlanningStats GetStats() const override
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+  }
+
+private:
+  /**
+   * @brief The query of FindPath, adding the stats of every worker to stats.
+   *
+   */
+  Path Search(const Node &start_node, const Node &goal_node,
+              const std::shared_ptr<Map> map, PlanningStats &stats);
+  void Work(Sampler sampler, const Node &goal_node,
+            ConcurrentSpatialHashGrid &spatial_hash_grid, ConcurrentTree &tree,
+            const std::shared_ptr<Map> map, PlanningStats &stats);
+
+  /**
+   * @brief Add a goal node below new node if it is in goal radius and cheaper
+   * than the current goal.
+   *
+   */
+  void UpdateGoal(const NodeIndex new_index, const Node &goal_node,
+                  ConcurrentTree &tree, PlanningStats &stats);
+
+  // Tree of the running or last query, swapped with atomic_store so GetLog
+  // never waits for the workers.
+  std::shared_ptr<ConcurrentTree> tree_{std::make_shared<ConcurrentTree>(0)};
+  std::atomic<NodeIndex> goal_index_{kInvalidNodeIndex};
+
+  std::atomic<int> iteration_{0};
+
+  // Each worker counts into its own stats. Their sum is published here,
+  // guarded by stats_mutex_, once the query ends.
+  PlanningStats stats_{};
+  mutable std::mutex stats_mutex_;
+
+  int max_iteration_{10000};
+  int max_branch_length_{10};
+  int min_branch_length_{5};
+  int neighbor_radius_{15};
+  int goal_radius_{5};
+  unsigned int thread_count_{std::max(std::thread::hardware_concurrency(), 1u)};
+  std::uint64_t seed_{std::random_device{}()};
+};
+
+} // namespace tree_base
+} // namespace planning
+
+#endif /* PLANNING_TREE_BASE_PARALLEL_RRT_STAR_PARALLEL_RRT_STAR_H_ */
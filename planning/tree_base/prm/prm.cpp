@@ -0,0 +1,509 @@
+/**
+ * @file prm.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "prm.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace planning
+{
+namespace tree_base
+{
+
+namespace
+{
+
+constexpr auto kInvalidRoadmapIndex{std::numeric_limits<RoadmapIndex>::max()};
+
+/**
+ * @brief Run function(begin, end, thread) over [0, count) in chunks taken by
+ * thread_count threads.
+ *
+ */
+void ParallelFor(
+    const std::size_t count, const unsigned int thread_count,
+    const std::function<void(std::size_t, std::size_t, unsigned int)>
+        &function)
+{
+  constexpr std::size_t kChunkSize{64};
+  std::atomic<std::size_t> next{0};
+  auto work{[&](const unsigned int thread) {
+    for (auto begin = next.fetch_add(kChunkSize); begin < count;
+         begin = next.fetch_add(kChunkSize))
+      {
+        function(begin, std::min(begin + kChunkSize, count), thread);
+      }
+  }};
+  std::vector<std::thread> threads;
+  for (auto i = 1u; i < thread_count; i++)
+    {
+      threads.emplace_back(work, i);
+    }
+  work(0);
+  for (auto &thread : threads)
+    {
+      thread.join();
+    }
+}
+
+} // namespace
+
+template <typename Logging>
+Path BasicPRM<Logging>::FindPath(const Node &start_node, const Node &goal_node,
+                                 const std::shared_ptr<Map> map)
+{
+  query_stats_ = PlanningStats{};
+  Path path;
+  {
+    PhaseTimer timer(query_stats_.total_time);
+    path = Query(start_node, goal_node, map);
+  }
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  stats_ = query_stats_;
+  return path;
+}
+
+template <typename Logging>
+Path BasicPRM<Logging>::Query(const Node &start_node, const Node &goal_node,
+                              const std::shared_ptr<Map> map)
+{
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      ClearLog();
+      return Path();
+    }
+
+  roadmap_save_failed_ = false;
+  if (roadmap_.Empty() || roadmap_map_.lock() != map)
+    {
+      if (roadmap_file_.empty() || !LoadRoadmap(roadmap_file_, map))
+        {
+          BuildRoadmap(map);
+          roadmap_save_failed_ =
+              !roadmap_file_.empty() && !SaveRoadmap(roadmap_file_);
+        }
+    }
+
+  // Start and goal join the roadmap as the last two nodes of the search.
+  const auto size{static_cast<RoadmapIndex>(roadmap_.Size())};
+  const auto goal_index{size + 1};
+  std::vector<RoadmapIndex> start_connections;
+  std::vector<RoadmapIndex> goal_connections;
+  ConnectQueryNode(start_node, true, map, start_connections);
+  ConnectQueryNode(goal_node, false, map, goal_connections);
+  std::vector<char> is_goal_neighbor(size, 0);
+  for (const auto index : goal_connections)
+    {
+      is_goal_neighbor[index] = 1;
+    }
+  query_stats_.collision_checks++;
+  if (!CheckIfCollisionBetweenNodes(start_node, goal_node, map))
+    {
+      start_connections.emplace_back(goal_index);
+    }
+
+  // Lazy roadmaps are searched optimistically. Unchecked edges of the found
+  // path are checked and invalid ones are skipped by the next search.
+  std::vector<RoadmapIndex> path_indices;
+  while (Search(start_node, goal_node, start_connections, is_goal_neighbor,
+                path_indices))
+    {
+      if (ValidatePath(path_indices, map))
+        {
+          // The path runs from the start index to the goal index.
+          Path path{start_node};
+          for (auto i = 1u; i + 1 < path_indices.size(); i++)
+            {
+              path.emplace_back(roadmap_.GetNode(path_indices[i]));
+            }
+          path.emplace_back(goal_node);
+          return path;
+        }
+    }
+
+  return Path();
+}
+
+template <typename Logging>
+bool BasicPRM<Logging>::Search(
+    const Node &start_node, const Node &goal_node,
+    const std::vector<RoadmapIndex> &start_connections,
+    const std::vector<char> &is_goal_neighbor,
+    std::vector<RoadmapIndex> &path_indices)
+{
+  const auto size{static_cast<RoadmapIndex>(roadmap_.Size())};
+  const auto start_index{size};
+  const auto goal_index{size + 1};
+  auto get_node{[&](const RoadmapIndex index) {
+    return index == start_index  ? start_node
+           : index == goal_index ? goal_node
+                                 : roadmap_.GetNode(index);
+  }};
+  std::vector<double> costs(size + 2, std::numeric_limits<double>::max());
+  std::vector<RoadmapIndex> parents(size + 2, kInvalidRoadmapIndex);
+  // Tree node of each closed roadmap node, 0 with NoLogging.
+  std::vector<NodeIndex> tree_indices(size + 2, kInvalidNodeIndex);
+  using QueueElement = std::pair<double, RoadmapIndex>;
+  std::priority_queue<QueueElement, std::vector<QueueElement>,
+                      std::greater<QueueElement>>
+      open;
+  costs[start_index] = 0.0;
+  open.emplace(EuclideanDistance(start_node, goal_node), start_index);
+  query_stats_.nodes_generated++;
+
+  {
+    LogLock<Logging> lock(log_mutex_);
+    tree_.Clear();
+    goal_index_ = kInvalidNodeIndex;
+  }
+  auto relax{[&](const RoadmapIndex current, const RoadmapIndex next) {
+    if (tree_indices[next] != kInvalidNodeIndex)
+      {
+        return;
+      }
+    const auto next_node{get_node(next)};
+    const auto cost{costs[current] +
+                    EuclideanDistance(get_node(current), next_node)};
+    if (cost < costs[next])
+      {
+        costs[next] = cost;
+        parents[next] = current;
+        open.emplace(cost + EuclideanDistance(next_node, goal_node), next);
+        query_stats_.nodes_generated++;
+        query_stats_.open_list_peak =
+            std::max(query_stats_.open_list_peak, open.size());
+      }
+  }};
+
+  while (!open.empty())
+    {
+      if (stop_condition_.ShouldStop())
+        {
+          return false;
+        }
+
+      const auto current{open.top().second};
+      open.pop();
+      if (tree_indices[current] != kInvalidNodeIndex)
+        {
+          continue;
+        }
+      query_stats_.nodes_expanded++;
+
+      const auto parent{parents[current]};
+      if constexpr (Logging::kEnabled)
+        {
+          std::lock_guard<std::mutex> lock(log_mutex_);
+          const auto parent_index{parent == kInvalidRoadmapIndex
+                                      ? kInvalidNodeIndex
+                                      : tree_indices[parent]};
+          const auto hops{parent_index == kInvalidNodeIndex
+                              ? 0.0
+                              : tree_.GetCost(parent_index).g + 1};
+          tree_indices[current] = tree_.AddNode(
+              get_node(current), parent_index, Cost(hops, costs[current]));
+        }
+      else
+        {
+          tree_indices[current] = 0;
+        }
+      if (current == goal_index)
+        {
+          path_indices.clear();
+          for (auto index = goal_index; index != kInvalidRoadmapIndex;
+               index = parents[index])
+            {
+              path_indices.emplace_back(index);
+            }
+          std::reverse(path_indices.begin(), path_indices.end());
+          if constexpr (Logging::kEnabled)
+            {
+              std::lock_guard<std::mutex> lock(log_mutex_);
+              goal_index_ = tree_indices[current];
+            }
+          return true;
+        }
+
+      if (current == start_index)
+        {
+          for (const auto next : start_connections)
+            {
+              relax(current, next);
+            }
+          continue;
+        }
+      for (auto edge = roadmap_.GetEdgeBegin(current);
+           edge < roadmap_.GetEdgeEnd(current); edge++)
+        {
+          if (roadmap_.GetEdgeState(edge) != EdgeState::kInvalid)
+            {
+              relax(current, roadmap_.GetNeighbor(edge));
+            }
+        }
+      if (is_goal_neighbor[current])
+        {
+          relax(current, goal_index);
+        }
+    }
+
+  return false;
+}
+
+template <typename Logging>
+bool BasicPRM<Logging>::ValidatePath(
+    const std::vector<RoadmapIndex> &path_indices,
+    const std::shared_ptr<Map> map)
+{
+  PhaseTimer timer(query_stats_.collision_time);
+  // Start and goal connections are checked when they are made.
+  for (auto i = 1u; i < path_indices.size(); i++)
+    {
+      const auto index{path_indices[i - 1]};
+      const auto next{path_indices[i]};
+      if (index >= roadmap_.Size() || next >= roadmap_.Size())
+        {
+          continue;
+        }
+      const auto edge{roadmap_.FindEdge(index, next)};
+      if (roadmap_.GetEdgeState(edge) == EdgeState::kUnchecked)
+        {
+          roadmap_.SetEdgeState(edge,
+                                IsEdgeFree(roadmap_.GetNode(index),
+                                           roadmap_.GetNode(next), map,
+                                           query_stats_)
+                                    ? EdgeState::kValid
+                                    : EdgeState::kInvalid);
+        }
+      if (roadmap_.GetEdgeState(edge) == EdgeState::kInvalid)
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+template <typename Logging> Log BasicPRM<Logging>::GetLog()
+{
+  if constexpr (!Logging::kEnabled)
+    {
+      return Log{};
+    }
+  std::lock_guard<std::mutex> lock(log_mutex_);
+  Log log{tree_.ToNodeParents(), nullptr};
+  if (goal_index_ != kInvalidNodeIndex)
+    {
+      log.second = log.first[goal_index_];
+    }
+  return log;
+}
+
+template <typename Logging>
+void BasicPRM<Logging>::BuildRoadmap(const std::shared_ptr<Map> map)
+{
+  roadmap_map_ = map;
+  Sampler sampler(seed_);
+  sampler.SetMap(map);
+  if (sampler.GetFreeNodeCount() == 0)
+    {
+      roadmap_.Clear();
+      return;
+    }
+
+  std::vector<Node> nodes;
+  PhaseClock clock;
+  sampler.FreeNodes(sample_count_, nodes);
+  clock.Lap(query_stats_.sampling_time);
+  auto is_less{[](const Node &lhs, const Node &rhs) {
+    return lhs.x_ < rhs.x_ || (lhs.x_ == rhs.x_ && lhs.y_ < rhs.y_);
+  }};
+  std::sort(nodes.begin(), nodes.end(), is_less);
+  nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+  KDTree kd_tree;
+  for (auto i = 0u; i < nodes.size(); i++)
+    {
+      kd_tree.Insert(nodes[i], i);
+    }
+  clock.Lap(query_stats_.nearest_neighbor_time);
+  query_stats_.nodes_generated += nodes.size();
+  query_stats_.neighbor_queries += nodes.size();
+
+  // Each node proposes edges to its k nearest nodes. An edge proposed from
+  // both ends is kept once, with the smaller index first.
+  std::vector<std::vector<RoadmapEdge>> thread_candidates(thread_count_);
+  std::vector<PlanningStats> thread_stats(thread_count_);
+  ParallelFor(nodes.size(), thread_count_,
+              [&](const std::size_t begin, const std::size_t end,
+                  const unsigned int thread) {
+                PhaseTimer timer(thread_stats[thread].nearest_neighbor_time);
+                std::vector<std::size_t> ids;
+                for (auto i = begin; i < end; i++)
+                  {
+                    kd_tree.KNearest(nodes[i], neighbor_count_ + 1, ids);
+                    for (const auto id : ids)
+                      {
+                        if (id != i)
+                          {
+                            thread_candidates[thread].emplace_back(
+                                std::min(i, id), std::max(i, id));
+                          }
+                      }
+                  }
+              });
+  for (const auto &stats : thread_stats)
+    {
+      query_stats_ += stats;
+    }
+  std::vector<RoadmapEdge> candidates;
+  for (const auto &thread_candidate : thread_candidates)
+    {
+      candidates.insert(candidates.end(), thread_candidate.begin(),
+                        thread_candidate.end());
+    }
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                   candidates.end());
+
+  if (lazy_)
+    {
+      roadmap_.Build(nodes, candidates, EdgeState::kUnchecked);
+      return;
+    }
+
+  std::vector<char> is_valid;
+  ValidateEdges(nodes, candidates, map, is_valid);
+  std::vector<RoadmapEdge> edges;
+  for (auto i = 0u; i < candidates.size(); i++)
+    {
+      if (is_valid[i])
+        {
+          edges.emplace_back(candidates[i]);
+        }
+    }
+  roadmap_.Build(nodes, edges);
+}
+
+template <typename Logging>
+bool BasicPRM<Logging>::SaveRoadmap(const std::string &file_path) const
+{
+  auto map{roadmap_map_.lock()};
+  if (!map)
+    {
+      return false;
+    }
+  std::ofstream file(file_path, std::ios::binary);
+  roadmap_.Save(file, *map);
+  return static_cast<bool>(file);
+}
+
+template <typename Logging>
+bool BasicPRM<Logging>::LoadRoadmap(const std::string &file_path,
+                                    const std::shared_ptr<Map> map)
+{
+  std::ifstream file(file_path, std::ios::binary);
+  if (!file || !roadmap_.Load(file, *map))
+    {
+      return false;
+    }
+  roadmap_map_ = map;
+  return true;
+}
+
+template <typename Logging>
+void BasicPRM<Logging>::ValidateEdges(
+    const std::vector<Node> &nodes, const std::vector<RoadmapEdge> &candidates,
+    const std::shared_ptr<Map> map, std::vector<char> &is_valid)
+{
+  is_valid.assign(candidates.size(), 0);
+  std::vector<PlanningStats> thread_stats(thread_count_);
+  ParallelFor(candidates.size(), thread_count_,
+              [&](const std::size_t begin, const std::size_t end,
+                  const unsigned int thread) {
+                auto &stats{thread_stats[thread]};
+                PhaseTimer timer(stats.collision_time);
+                for (auto i = begin; i < end; i++)
+                  {
+                    is_valid[i] =
+                        IsEdgeFree(nodes[candidates[i].first],
+                                   nodes[candidates[i].second], map, stats);
+                  }
+              });
+  for (const auto &stats : thread_stats)
+    {
+      query_stats_ += stats;
+    }
+}
+
+template <typename Logging>
+bool BasicPRM<Logging>::IsEdgeFree(const Node &node1, const Node &node2,
+                                   const std::shared_ptr<Map> map,
+                                   PlanningStats &stats)
+{
+  // Rays are not symmetric and an edge is searched in both directions, so
+  // both must be free.
+  stats.collision_checks++;
+  if (CheckIfCollisionBetweenNodes(node1, node2, map))
+    {
+      return false;
+    }
+  stats.collision_checks++;
+  return !CheckIfCollisionBetweenNodes(node2, node1, map);
+}
+
+template <typename Logging>
+void BasicPRM<Logging>::ConnectQueryNode(
+    const Node &node, const bool is_start, const std::shared_ptr<Map> map,
+    std::vector<RoadmapIndex> &connections)
+{
+  connections.clear();
+  if (roadmap_.Empty())
+    {
+      return;
+    }
+
+  // Widen the search until a visible roadmap node is found. Ids are nearest
+  // first, so a wider search only checks the new ones.
+  std::vector<std::size_t> ids;
+  auto checked{0u};
+  PhaseClock clock;
+  for (auto k = std::min<std::size_t>(neighbor_count_, roadmap_.Size());
+       connections.empty() && checked < roadmap_.Size();
+       k = std::min(4 * k, roadmap_.Size()))
+    {
+      roadmap_.GetKDTree().KNearest(node, k, ids);
+      query_stats_.neighbor_queries++;
+      clock.Lap(query_stats_.nearest_neighbor_time);
+      for (; checked < ids.size(); checked++)
+        {
+          query_stats_.collision_checks++;
+          const auto &roadmap_node{roadmap_.GetNode(ids[checked])};
+          const auto is_blocked{
+              is_start ? CheckIfCollisionBetweenNodes(node, roadmap_node, map)
+                       : CheckIfCollisionBetweenNodes(roadmap_node, node, map)};
+          if (!is_blocked)
+            {
+              connections.emplace_back(ids[checked]);
+            }
+        }
+      clock.Lap(query_stats_.collision_time);
+    }
+}
+
+template class BasicPRM<ExpansionLogging>;
+template class BasicPRM<NoLogging>;
+
+} // namespace tree_base
+} // namespace planning
@@ -0,0 +1,190 @@
+/**
+ * @file prm.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Probabilistic Roadmap (PRM) algorithm.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_TREE_BASE_PRM_PRM_H_
+#define PLANNING_TREE_BASE_PRM_PRM_H_
+
+#include "utility/common_tree_base.h"
+#include "utility/i_planning.h"
+#include "utility/roadmap.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace planning
+{
+namespace tree_base
+{
+
+/**
+ * @brief Multi-query Probabilistic Roadmap.
+ *
+ * Free samples are connected to their k nearest samples with edges that are
+ * collision free in both directions, validated on worker threads. The
+ * roadmap is built once for a map and reused while the same Map object is
+ * queried. A query connects start and goal to their nearest visible roadmap
+ * nodes and runs A* over the roadmap. Edges may also be checked lazily, see
+ * SetLazy. A query stopped through FindPathAsync returns an empty path. The
+ * roadmap of a new map is always finished first, later queries reuse it.
+ *
+ * Logging is ExpansionLogging or NoLogging. With NoLogging no search tree is
+ * built and GetLog is empty.
+ */
+template <typename Logging> class BasicPRM : public IPlanningWithLogging
+{
+public:
+  BasicPRM() {}
+  BasicPRM(const int sample_count, const int neighbor_count,
+           const unsigned int thread_count)
+      : sample_count_(sample_count), neighbor_count_(neighbor_count),
+        thread_count_(thread_count > 0
+                          ? thread_count
+                          : std::max(std::thread::hardware_concurrency(), 1u))
+  {
+  }
+  ~BasicPRM() {}
+  Path FindPath(const Node &start_node, const Node &goal_node,
+                const std::shared_ptr<Map> map) override;
+  Log GetLog() override;
+  void ClearLog() override
+  {
+    LogLock<Logging> lock(log_mutex_);
+    tree_.Clear();
+    goal_index_ = kInvalidNodeIndex;
+  }
+
+  /**
+   * @brief Seed of the roadmap sampler.
+   *
+   */
+  void SetSeed(const std::uint64_t seed) { seed_ = seed; }
+
+  /**
+   * @brief File the roadmap of a new map is loaded from, or saved to after it
+   * is built. Empty disables it.
+   *
+   */
+  void SetRoadmapFile(const std::string &roadmap_file)
+  {
+    roadmap_file_ = roadmap_file;
+  }
+
+  /**
+   * @brief Whether the last query built a roadmap that could not be saved to
+   * the roadmap file. The query itself is not affected.
+   *
+   */
+  bool HasRoadmapSaveFailed() const { return roadmap_save_failed_; }
+
+  /**
+   * @brief Build the roadmap of map. Needed again after map is edited.
+   *
+   */
+  void BuildRoadmap(const std::shared_ptr<Map> map);
+
+  /**
+   * @brief Save the roadmap with a fingerprint of the map it was built for.
+   *
+   * @return true if the file is written.
+   */
+  bool SaveRoadmap(const std::string &file_path) const;
+
+  /**
+   * @brief Load a roadmap saved for map.
+   *
+   * @return false if the file cannot be read or was saved for another map.
+   */
+  bool LoadRoadmap(const std::string &file_path,
+                   const std::shared_ptr<Map> map);
+
+  /**
+   * @brief Lazy PRM. Roadmap edges are not checked when the roadmap is built.
+   * Queries search the roadmap optimistically, check only the edges of the
+   * found path and search again without the invalid ones. Checked edges stay
+   * checked for later queries on the same roadmap.
+   *
+   */
+  void SetLazy(const bool lazy) { lazy_ = lazy; }
+
+  const Roadmap &GetRoadmap() const { return roadmap_; }
+
+  /**
+   * @brief Stats of the last query, including the roadmap build if the query
+   * built one. Build times are added up over the worker threads.
+   *
+   */
+  PlanningStats GetStats() const override
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+  }
+
+private:
+  /**
+   * @brief The query of FindPath, counting into query stats.
+   *
+   */
+  Path Query(const Node &start_node, const Node &goal_node,
+             const std::shared_ptr<Map> map);
+  void ValidateEdges(const std::vector<Node> &nodes,
+                     const std::vector<RoadmapEdge> &candidates,
+                     const std::shared_ptr<Map> map,
+                     std::vector<char> &is_valid);
+  bool Search(const Node &start_node, const Node &goal_node,
+              const std::vector<RoadmapIndex> &start_connections,
+              const std::vector<char> &is_goal_neighbor,
+              std::vector<RoadmapIndex> &path_indices);
+  bool ValidatePath(const std::vector<RoadmapIndex> &path_indices,
+                    const std::shared_ptr<Map> map);
+  static bool IsEdgeFree(const Node &node1, const Node &node2,
+                         const std::shared_ptr<Map> map, PlanningStats &stats);
+  void ConnectQueryNode(const Node &node, const bool is_start,
+                        const std::shared_ptr<Map> map,
+                        std::vector<RoadmapIndex> &connections);
+
+  Roadmap roadmap_{};
+  // Map the roadmap belongs to, expired or different means rebuild.
+  std::weak_ptr<Map> roadmap_map_{};
+
+  // Search tree of the last query, guarded by log_mutex_ for GetLog.
+  Tree tree_{};
+  NodeIndex goal_index_{kInvalidNodeIndex};
+
+  int sample_count_{2000};
+  int neighbor_count_{10};
+  unsigned int thread_count_{std::max(std::thread::hardware_concurrency(), 1u)};
+  bool lazy_{false};
+  std::string roadmap_file_{};
+  std::atomic<bool> roadmap_save_failed_{false};
+  std::uint64_t seed_{std::random_device{}()};
+  // Only the query thread counts into query stats, roadmap workers count into
+  // their own. They are published to stats, guarded by stats_mutex_, once the
+  // query ends.
+  PlanningStats query_stats_{};
+  PlanningStats stats_{};
+  mutable std::mutex stats_mutex_;
+  std::mutex log_mutex_;
+};
+
+using PRM = BasicPRM<ExpansionLogging>;
+
+} // namespace tree_base
+} // namespace planning
+
+#endif /* PLANNING_TREE_BASE_PRM_PRM_H_ */
@@ -13,72 +13,124 @@
 #include <chrono>
 #include <cstddef>
 #include <iostream>
-#include <mutex>
 #include <thread>
 namespace planning
 {
 namespace tree_base
 {
 
-Path RRT::FindPath(const Node &start_node, const Node &goal_node,
-                   const std::shared_ptr<Map> map)
+template <typename Logging>
+std::unique_ptr<PlanningContext> BasicRRT<Logging>::CreateContext() const
 {
-  auto map_copy{std::make_shared<Map>(*map)};
-  map_copy->SetNodeState(start_node, NodeState::kStart);
+  return std::make_unique<Context>();
+}
+
+template <typename Logging>
+void BasicRRT<Logging>::Begin(const Node &start_node, const Node &goal_node,
+                              const std::shared_ptr<Map> map,
+                              PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  context.Clear();
+  context.SetRunning();
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      context.SetResult(Path());
+      return;
+    }
+
+  context.goal_node = goal_node;
+  context.iteration = 0;
+  context.sampler = std::make_unique<Sampler>(seed_);
+  context.sampler->SetMap(map);
+  if (context.sampler->GetFreeNodeCount() == 0)
+    {
+      context.SetResult(Path());
+      return;
+    }
+  context.map->CopyCells(*map);
+  context.map->SetNodeState(start_node, NodeState::kStart);
+
+  context.kd_tree.Clear();
+  context.kd_tree.Insert(start_node, 0);
+  context.tree.Reserve(max_iteration_ + 2);
+  context.template AddNode<Logging>(start_node, kInvalidNodeIndex, Cost{});
+}
+
+template <typename Logging>
+PlanningStatus BasicRRT<Logging>::Step(const std::size_t iterations,
+                                       PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  if (context.GetStatus() != PlanningStatus::kRunning)
+    {
+      return context.GetStatus();
+    }
 
-  auto root{std::make_shared<NodeParent>(start_node, nullptr, Cost{})};
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.first.clear();
-    log_.second = nullptr;
-    log_.first.emplace_back(root);
-  }
+  PhaseTimer timer(context.stats.total_time);
 
-  for (auto i = 0; i < max_iteration_; i++)
+  auto &stats{context.stats};
+  auto &tree{context.tree};
+  auto &kd_tree{context.kd_tree};
+  const auto &goal_node{context.goal_node};
+  Node new_node;
+  PhaseClock clock;
+  for (std::size_t i = 0; i < iterations; i++)
     {
-      auto random_node{RandomNode(map_copy)};
-      auto nearest_node{GetNearestNodeParent(random_node, log_.first)};
-      auto new_node{WireNewNode(max_branch_length_, min_branch_length_,
-                                random_node, nearest_node, map_copy)};
+      if (context.iteration++ >= max_iteration_ || context.ShouldStop())
+        {
+          return context.SetResult(Path());
+        }
+      stats.nodes_expanded++;
+      clock.Restart();
 
-      if (new_node == nullptr)
+      auto random_node{context.sampler->FreeNode()};
+      clock.Lap(stats.sampling_time);
+      auto nearest_index{kd_tree.Nearest(random_node)};
+      auto nearest_node{tree.GetNode(nearest_index)};
+      stats.neighbor_queries++;
+      clock.Lap(stats.nearest_neighbor_time);
+      const auto is_wired{WireNewNode(max_branch_length_, min_branch_length_,
+                                      random_node, nearest_node, context.map,
+                                      new_node)};
+      // Steering only fails, without a ray cast, below min branch length.
+      stats.collision_checks +=
+          EuclideanDistance(random_node, nearest_node) >= min_branch_length_;
+      clock.Lap(stats.collision_time);
+      if (!is_wired)
         {
           continue;
         }
 
-      new_node->cost =
-          Cost(nearest_node->cost.g + 1,
-               nearest_node->cost.h +
-                   EuclideanDistance(new_node->node, nearest_node->node));
+      const auto &nearest_cost{tree.GetCost(nearest_index)};
+      auto new_cost{Cost(nearest_cost.g + 1,
+                         nearest_cost.h +
+                             EuclideanDistance(new_node, nearest_node))};
 
-      {
-        std::lock_guard<std::mutex> lock(log_mutex_);
-        log_.first.emplace_back(new_node);
-      }
-      map_copy->SetNodeState(new_node->node, NodeState::kVisited);
+      auto new_index{context.template AddNode<Logging>(new_node, nearest_index,
+                                                       new_cost)};
+      kd_tree.Insert(new_node, new_index);
+      context.map->SetNodeState(new_node, NodeState::kVisited);
+      clock.Lap(stats.nearest_neighbor_time);
 
       // Check if goal node is in radius.
-      if (EuclideanDistance(new_node->node, goal_node) <= goal_radius_)
+      if (EuclideanDistance(new_node, goal_node) <= goal_radius_)
         {
-          // Add goal node to visited nodes.
-          auto goal{std::make_shared<NodeParent>(
-              goal_node, new_node,
-              Cost(new_node->cost.g + 1,
-                   new_node->cost.h +
-                       EuclideanDistance(new_node->node, goal_node)))};
-          {
-            std::lock_guard<std::mutex> lock(log_mutex_);
-            log_.first.emplace_back(goal);
-            log_.second = goal;
-          }
+          // Add goal node to the tree.
+          context.template SetGoal<Logging>(context.template AddNode<Logging>(
+              goal_node, new_index,
+              Cost(new_cost.g + 1,
+                   new_cost.h + EuclideanDistance(new_node, goal_node))));
 
           // Get path.
-          return ReconstructPath(goal);
+          return context.SetResult(tree.ReconstructPath(context.goal_index));
         }
     }
-
-  return Path();
+  return PlanningStatus::kRunning;
 }
 
+template class BasicRRT<ExpansionLogging>;
+template class BasicRRT<NoLogging>;
+
 } // namespace tree_base
 } // namespace planning
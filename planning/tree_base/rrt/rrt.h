@@ -16,9 +16,10 @@
 #include "utility/i_planning.h"
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <memory>
-#include <mutex>
 #include <random>
 #include <vector>
 
@@ -29,44 +30,57 @@ namespace tree_base
 
 /**
  * @brief Rapidly-exploring Random Tree algorithm implementation.
+ * Logging is ExpansionLogging or NoLogging.
  *
  */
-class RRT : public IPlanningWithLogging
+template <typename Logging> class BasicRRT : public PlanningWithContext
 {
 public:
-  RRT() {}
-  RRT(const int max_iteration) : max_iteration_(max_iteration) {}
-  RRT(const int max_iteration, const int max_branch_length,
-      const int min_branch_length, const int goal_radius)
+  BasicRRT() {}
+  BasicRRT(const int max_iteration) : max_iteration_(max_iteration) {}
+  BasicRRT(const int max_iteration, const int max_branch_length,
+           const int min_branch_length, const int goal_radius)
       : max_iteration_(max_iteration), max_branch_length_(max_branch_length),
         min_branch_length_(min_branch_length), goal_radius_(goal_radius)
   {
   }
-  ~RRT() {}
-  Path FindPath(const Node &start_node, const Node &goal_node,
-                const std::shared_ptr<Map> map) override;
-  Log GetLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    return log_;
-  }
-  void ClearLog() override
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.first.clear();
-    log_.second = nullptr;
-  }
+  ~BasicRRT() {}
+  std::unique_ptr<PlanningContext> CreateContext() const override;
+  void Begin(const Node &start_node, const Node &goal_node,
+             const std::shared_ptr<Map> map,
+             PlanningContext &context) const override;
+  PlanningStatus Step(const std::size_t iterations,
+                      PlanningContext &context) const override;
+
+  /**
+   * @brief Seed of the sampler. Every FindPath call restarts from this seed,
+   * so the same seed and map give the same tree.
+   *
+   */
+  void SetSeed(const std::uint64_t seed) { seed_ = seed; }
 
 private:
-  Log log_{};
+  /**
+   * @brief Tree, sampler and progress of one query.
+   *
+   */
+  class Context : public TreePlanningContext
+  {
+  public:
+    std::unique_ptr<Sampler> sampler{};
+    Node goal_node{};
+    int iteration{0};
+  }; // class Context
 
   int max_iteration_{10000};
   int max_branch_length_{10};
   int min_branch_length_{5};
   int goal_radius_{5};
-  std::mutex log_mutex_;
+  std::uint64_t seed_{std::random_device{}()};
 };
 
+using RRT = BasicRRT<ExpansionLogging>;
+
 } // namespace tree_base
 } // namespace planning
 
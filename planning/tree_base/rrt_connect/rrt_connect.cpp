@@ -0,0 +1,225 @@
+/**
+ * @file rrt_connect.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "rrt_connect.h"
+
+#include <mutex>
+#include <utility>
+
+namespace planning
+{
+namespace tree_base
+{
+
+template <typename Logging>
+Path BasicRRTConnect<Logging>::FindPath(const Node &start_node,
+                                        const Node &goal_node,
+                                        const std::shared_ptr<Map> map)
+{
+  query_stats_ = PlanningStats{};
+  Path path;
+  {
+    PhaseTimer timer(query_stats_.total_time);
+    path = Search(start_node, goal_node, map);
+  }
+  std::lock_guard<std::mutex> lock(stats_mutex_);
+  stats_ = query_stats_;
+  return path;
+}
+
+template <typename Logging>
+Path BasicRRTConnect<Logging>::Search(const Node &start_node,
+                                      const Node &goal_node,
+                                      const std::shared_ptr<Map> map)
+{
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      ClearLog();
+      return Path();
+    }
+
+  Sampler sampler(seed_);
+  sampler.SetMap(map);
+  if (sampler.GetFreeNodeCount() == 0)
+    {
+      ClearLog();
+      return Path();
+    }
+
+  KDTree start_kd_tree;
+  KDTree goal_kd_tree;
+  start_kd_tree.Insert(start_node, 0);
+  goal_kd_tree.Insert(goal_node, 0);
+  {
+    LogLock<Logging> lock(log_mutex_);
+    start_tree_.Clear();
+    goal_tree_.Clear();
+    start_tree_.AddNode(start_node, kInvalidNodeIndex, Cost{});
+    goal_tree_.AddNode(goal_node, kInvalidNodeIndex, Cost{});
+    query_stats_.nodes_generated = 2;
+    start_meet_index_ = kInvalidNodeIndex;
+    goal_meet_index_ = kInvalidNodeIndex;
+  }
+
+  auto tree_a{&start_tree_};
+  auto tree_b{&goal_tree_};
+  auto kd_tree_a{&start_kd_tree};
+  auto kd_tree_b{&goal_kd_tree};
+  for (auto i = 0; i < max_iteration_; i++)
+    {
+      if (stop_condition_.ShouldStop())
+        {
+          return Path();
+        }
+      query_stats_.nodes_expanded++;
+      clock_.Restart();
+      auto random_node{sampler.FreeNode()};
+      clock_.Lap(query_stats_.sampling_time);
+      if (Extend(*tree_a, *kd_tree_a, random_node, map) !=
+          ExtendResult::kTrapped)
+        {
+          const auto new_index{tree_a->Size() - 1};
+          NodeIndex meet_index;
+          if (Connect(*tree_b, *kd_tree_b, tree_a->GetNode(new_index), map,
+                      meet_index) == ExtendResult::kReached)
+            {
+              LogLock<Logging> lock(log_mutex_);
+              const auto is_start_tree_a{tree_a == &start_tree_};
+              start_meet_index_ = is_start_tree_a ? new_index : meet_index;
+              goal_meet_index_ = is_start_tree_a ? meet_index : new_index;
+
+              auto path{start_tree_.ReconstructPath(start_meet_index_)};
+              auto goal_path{goal_tree_.ReconstructPath(goal_meet_index_)};
+              auto goal_path_begin{goal_path.rbegin()};
+              if (path.back() == *goal_path_begin)
+                {
+                  goal_path_begin++;
+                }
+              path.insert(path.end(), goal_path_begin, goal_path.rend());
+              return path;
+            }
+        }
+      std::swap(tree_a, tree_b);
+      std::swap(kd_tree_a, kd_tree_b);
+    }
+
+  return Path();
+}
+
+template <typename Logging> Log BasicRRTConnect<Logging>::GetLog()
+{
+  if constexpr (!Logging::kEnabled)
+    {
+      return Log{};
+    }
+  LogLock<Logging> lock(log_mutex_);
+  Log log{start_tree_.ToNodeParents(), nullptr};
+  auto goal_nodes{goal_tree_.ToNodeParents()};
+  if (start_meet_index_ != kInvalidNodeIndex)
+    {
+      // Hang the goal side of the path below the meeting node of the start
+      // tree, so the path can be backtraced from the goal.
+      auto parent{log.first[start_meet_index_]};
+      for (auto index = goal_meet_index_; index != kInvalidNodeIndex;
+           index = goal_tree_.GetParent(index))
+        {
+          auto node{goal_tree_.GetNode(index)};
+          auto cost{
+              Cost(parent->cost.g + 1,
+                   parent->cost.h + EuclideanDistance(node, parent->node))};
+          parent = std::make_shared<NodeParent>(node, parent, cost);
+          goal_nodes.emplace_back(parent);
+        }
+      log.second = parent;
+    }
+  log.first.insert(log.first.end(), goal_nodes.begin(), goal_nodes.end());
+  return log;
+}
+
+template <typename Logging>
+typename BasicRRTConnect<Logging>::ExtendResult
+BasicRRTConnect<Logging>::Extend(Tree &tree, KDTree &kd_tree,
+                                 const Node &target,
+                                 const std::shared_ptr<Map> map)
+{
+  const auto nearest_index{kd_tree.Nearest(target)};
+  const auto nearest_node{tree.GetNode(nearest_index)};
+  query_stats_.neighbor_queries++;
+  clock_.Lap(query_stats_.nearest_neighbor_time);
+  Node new_node;
+  const auto is_wired{WireNewNode(max_branch_length_, min_branch_length_,
+                                  target, nearest_node, map, new_node)};
+  // Steering only fails, without a ray cast, below min branch length.
+  query_stats_.collision_checks +=
+      EuclideanDistance(target, nearest_node) >= min_branch_length_;
+  clock_.Lap(query_stats_.collision_time);
+  if (!is_wired)
+    {
+      return ExtendResult::kTrapped;
+    }
+
+  const auto &nearest_cost{tree.GetCost(nearest_index)};
+  auto new_cost{
+      Cost(nearest_cost.g + 1,
+           nearest_cost.h + EuclideanDistance(new_node, nearest_node))};
+
+  NodeIndex new_index;
+  {
+    LogLock<Logging> lock(log_mutex_);
+    query_stats_.allocations += tree.Size() == tree.Capacity();
+    new_index = tree.AddNode(new_node, nearest_index, new_cost);
+  }
+  query_stats_.nodes_generated++;
+  kd_tree.Insert(new_node, new_index);
+  clock_.Lap(query_stats_.nearest_neighbor_time);
+
+  return new_node == target ? ExtendResult::kReached : ExtendResult::kAdvanced;
+}
+
+template <typename Logging>
+typename BasicRRTConnect<Logging>::ExtendResult
+BasicRRTConnect<Logging>::Connect(Tree &tree, KDTree &kd_tree,
+                                  const Node &target,
+                                  const std::shared_ptr<Map> map,
+                                  NodeIndex &meet_index)
+{
+  // Every extension gets closer to target by at least min branch length, so
+  // the loop ends.
+  while (true)
+    {
+      const auto nearest_index{kd_tree.Nearest(target)};
+      const auto nearest_node{tree.GetNode(nearest_index)};
+      query_stats_.neighbor_queries++;
+      clock_.Lap(query_stats_.nearest_neighbor_time);
+      if (EuclideanDistance(nearest_node, target) <= max_branch_length_)
+        {
+          query_stats_.collision_checks++;
+          const auto is_visible{
+              !CheckIfCollisionBetweenNodes(nearest_node, target, map)};
+          clock_.Lap(query_stats_.collision_time);
+          if (is_visible)
+            {
+              meet_index = nearest_index;
+              return ExtendResult::kReached;
+            }
+        }
+      if (Extend(tree, kd_tree, target, map) == ExtendResult::kTrapped)
+        {
+          return ExtendResult::kTrapped;
+        }
+    }
+}
+
+template class BasicRRTConnect<ExpansionLogging>;
+template class BasicRRTConnect<NoLogging>;
+
+} // namespace tree_base
+} // namespace planning
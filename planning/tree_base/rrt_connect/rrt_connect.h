@@ -0,0 +1,137 @@
+/**
+ * @file rrt_connect.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Bidirectional RRT-Connect algorithm.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_TREE_BASE_RRT_CONNECT_RRT_CONNECT_H_
+#define PLANNING_TREE_BASE_RRT_CONNECT_RRT_CONNECT_H_
+
+#include "utility/common_tree_base.h"
+#include "utility/i_planning.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+namespace planning
+{
+namespace tree_base
+{
+
+/**
+ * @brief RRT-Connect. Grows one tree from the start and one from the goal.
+ * Every iteration extends one tree towards a random node, then greedily
+ * extends the other tree towards the new node until it is reached or blocked.
+ * The trees swap roles every iteration. A query stopped through
+ * FindPathAsync returns an empty path. Logging is ExpansionLogging or
+ * NoLogging; with NoLogging the trees are only kept for the search.
+ */
+template <typename Logging> class BasicRRTConnect : public IPlanningWithLogging
+{
+public:
+  BasicRRTConnect() {}
+  BasicRRTConnect(const int max_iteration) : max_iteration_(max_iteration) {}
+  BasicRRTConnect(const int max_iteration, const int max_branch_length,
+                  const int min_branch_length)
+      : max_iteration_(max_iteration), max_branch_length_(max_branch_length),
+        min_branch_length_(min_branch_length)
+  {
+  }
+  ~BasicRRTConnect() {}
+  Path FindPath(const Node &start_node, const Node &goal_node,
+                const std::shared_ptr<Map> map) override;
+
+  /**
+   * @brief Both trees, followed by the joined path whose last node is the
+   * goal if a path is found. Empty with NoLogging.
+   *
+   */
+  Log GetLog() override;
+  void ClearLog() override
+  {
+    LogLock<Logging> lock(log_mutex_);
+    start_tree_.Clear();
+    goal_tree_.Clear();
+    start_meet_index_ = kInvalidNodeIndex;
+    goal_meet_index_ = kInvalidNodeIndex;
+  }
+
+  /**
+   * @brief Seed of the sampler. Every FindPath call restarts from this seed,
+   * so the same seed and map give the same trees.
+   *
+   */
+  void SetSeed(const std::uint64_t seed) { seed_ = seed; }
+
+  PlanningStats GetStats() const override
+  {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    return stats_;
+  }
+
+private:
+  enum class ExtendResult
+  {
+    kTrapped,
+    kAdvanced,
+    kReached
+  };
+
+  /**
+   * @brief The query of FindPath, counting into query stats.
+   *
+   */
+  Path Search(const Node &start_node, const Node &goal_node,
+              const std::shared_ptr<Map> map);
+
+  /**
+   * @brief Add one branch from the nearest node of tree towards target.
+   *
+   */
+  ExtendResult Extend(Tree &tree, KDTree &kd_tree, const Node &target,
+                      const std::shared_ptr<Map> map);
+
+  /**
+   * @brief Extend tree towards target until target is in line of sight of
+   * the nearest node, or the extension is blocked.
+   *
+   * @param meet_index Nearest node that sees target, if reached.
+   */
+  ExtendResult Connect(Tree &tree, KDTree &kd_tree, const Node &target,
+                       const std::shared_ptr<Map> map, NodeIndex &meet_index);
+
+  // Trees of the last query, guarded by log_mutex_ for GetLog.
+  Tree start_tree_{};
+  Tree goal_tree_{};
+  NodeIndex start_meet_index_{kInvalidNodeIndex};
+  NodeIndex goal_meet_index_{kInvalidNodeIndex};
+
+  // Only the query thread counts into query stats. They are published to
+  // stats, guarded by stats_mutex_, once the query ends. Extend and Connect
+  // lap the clock of its iteration.
+  PlanningStats query_stats_{};
+  PlanningStats stats_{};
+  mutable std::mutex stats_mutex_;
+  PhaseClock clock_{};
+
+  int max_iteration_{10000};
+  int max_branch_length_{10};
+  int min_branch_length_{5};
+  std::uint64_t seed_{std::random_device{}()};
+  std::mutex log_mutex_;
+};
+
+using RRTConnect = BasicRRTConnect<ExpansionLogging>;
+
+} // namespace tree_base
+} // namespace planning
+
+#endif /* PLANNING_TREE_BASE_RRT_CONNECT_RRT_CONNECT_H_ */
@@ -11,168 +11,384 @@
 
 #include "rrt_star.h"
 #include "common_tree_base.h"
-#include "node_parent.h"
+#include "tree.h"
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
-#include <iostream>
+#include <cstdint>
 #include <limits>
 #include <memory>
-#include <mutex>
-#include <queue>
 
 namespace planning
 {
 namespace tree_base
 {
 
-Path RRTStar::FindPath(const Node &start_node, const Node &goal_node,
-                       const std::shared_ptr<Map> map)
+template <typename Logging>
+std::unique_ptr<PlanningContext> BasicRRTStar<Logging>::CreateContext() const
 {
-  auto start_time{std::chrono::high_resolution_clock::now()};
+  return std::make_unique<Context>();
+}
 
-  std::shared_ptr<NodeParent> final{std::nullptr_t()};
-  auto current_cost = std::numeric_limits<double>::max();
+template <typename Logging>
+std::size_t BasicRRTStar<Logging>::GetCollisionCheckCount() const
+{
+  auto context{GetLogContext()};
+  return context != nullptr ? GetCollisionCheckCount(*context) : 0;
+}
 
-  auto map_copy{std::make_shared<Map>(*map)};
+template <typename Logging>
+std::size_t
+BasicRRTStar<Logging>::GetCollisionCheckCount(const PlanningContext &context)
+{
+  return context.stats.collision_checks;
+}
 
-  auto root{std::make_shared<NodeParent>(Node(start_node), nullptr, Cost{})};
+template <typename Logging>
+void BasicRRTStar<Logging>::Begin(const Node &start_node, const Node &goal_node,
+                                  const std::shared_ptr<Map> map,
+                                  PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  context.Clear();
+  context.SetRunning();
+  if (!map->IsReachable(start_node, goal_node))
+    {
+      context.SetResult(Path());
+      return;
+    }
 
-  {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.first.clear();
-    log_.first.push_back(root);
-  }
+  context.start_node = start_node;
+  context.goal_node = goal_node;
+  context.iteration = 0;
+  context.pruned_cost = std::numeric_limits<double>::max();
 
-  for (auto i = 0; i < max_iteration_; i++)
+  context.sampler = std::make_unique<Sampler>(seed_);
+  context.sampler->SetMap(map);
+  if (context.sampler->GetFreeNodeCount() == 0)
     {
-      auto random_node{RandomNode(map_copy)};
-      auto neighbor_vector =
-          GetNearestNodeParentVector(neighbor_radius_, random_node, log_.first);
-      auto new_node =
-          WireNodeIfPossible(random_node, neighbor_vector, map_copy);
+      context.SetResult(Path());
+      return;
+    }
+  context.map->CopyCells(*map);
+
+  context.kd_tree.Clear();
+  context.kd_tree.Insert(start_node, 0);
+  context.spatial_hash_grid = std::make_unique<SpatialHashGrid>(
+      neighbor_radius_, map->GetHeight(), map->GetWidth());
+  context.spatial_hash_grid->Insert(start_node, 0);
 
-      if (new_node == nullptr)
+  context.tree.Reserve(max_iteration_ + 1);
+  context.checked_parents.clear();
+  context.checked_edges.clear();
+  AddTreeNode(start_node, kInvalidNodeIndex, Cost{}, context);
+  context.indexed_nodes.assign(1, 0);
+
+  context.termination = termination_;
+  context.termination.Start();
+}
+
+template <typename Logging>
+PlanningStatus
+BasicRRTStar<Logging>::Step(const std::size_t iterations,
+                            PlanningContext &planning_context) const
+{
+  auto &context{static_cast<Context &>(planning_context)};
+  if (context.GetStatus() != PlanningStatus::kRunning)
+    {
+      return context.GetStatus();
+    }
+
+  PhaseTimer timer(context.stats.total_time);
+
+  auto &stats{context.stats};
+  auto &tree{context.tree};
+  auto &kd_tree{context.kd_tree};
+  auto &spatial_hash_grid{*context.spatial_hash_grid};
+  auto &neighbor_indices{context.neighbor_indices};
+  const auto &start_node{context.start_node};
+  const auto &goal_node{context.goal_node};
+  const auto &map_copy{context.map};
+  Node new_node;
+  NodeIndex parent_index;
+  PhaseClock clock;
+  for (std::size_t i = 0; i < iterations; i++)
+    {
+      if (context.ShouldStop())
+        {
+          return context.SetResult(tree.ReconstructPath(context.goal_index));
+        }
+      if (context.iteration++ >= max_iteration_ ||
+          context.termination.ShouldStop(
+              context.goal_index != kInvalidNodeIndex
+                  ? tree.GetCost(context.goal_index).f
+                  : std::numeric_limits<double>::infinity()))
+        {
+          return context.SetResult(tree.ReconstructPath(context.goal_index));
+        }
+
+      stats.nodes_expanded++;
+      clock.Restart();
+
+      // Generator is only drawn from with a bias, so seeded runs without it
+      // are unchanged.
+      Node random_node;
+      if (goal_bias_ > 0.0 &&
+          context.sampler->GetGenerator().Uniform() < goal_bias_)
+        {
+          random_node = goal_node;
+        }
+      else if (informed_ && context.goal_index != kInvalidNodeIndex)
+        {
+          random_node = context.sampler->InformedNode(
+              start_node, goal_node, GetInformedDiameter(context));
+        }
+      else
+        {
+          random_node = context.sampler->FreeNode();
+        }
+      clock.Lap(stats.sampling_time);
+
+      GetNearestNodeIndices(neighbor_radius_, random_node, spatial_hash_grid,
+                            kd_tree, neighbor_indices);
+      stats.neighbor_queries++;
+      clock.Lap(stats.nearest_neighbor_time);
+
+      auto is_wired{false};
+      if (lazy_collision_checking_)
+        {
+          is_wired = LazyWireNodeIfPossible(random_node, map_copy, new_node,
+                                            parent_index, context);
+        }
+      else
+        {
+          SortNodeIndicesByCost(tree, neighbor_indices);
+          is_wired = WireNodeIfPossible(random_node, map_copy, new_node,
+                                        parent_index, context);
+        }
+      clock.Lap(stats.collision_time);
+      if (!is_wired)
         {
           continue;
         }
 
-      new_node->cost =
-          Cost(new_node->parent->cost.g + 1,
-               new_node->parent->cost.h +
-                   EuclideanDistance(new_node->node, new_node->parent->node));
+      const auto &parent_cost{tree.GetCost(parent_index)};
+      auto new_cost{Cost(parent_cost.g + 1,
+                         parent_cost.h +
+                             EuclideanDistance(new_node,
+                                               tree.GetNode(parent_index)))};
 
-      {
-        std::lock_guard<std::mutex> lock(log_mutex_);
-        log_.first.push_back(new_node);
-      }
+      auto new_index{AddTreeNode(new_node, parent_index, new_cost, context)};
+      kd_tree.Insert(new_node, new_index);
+      spatial_hash_grid.Insert(new_node, new_index);
+      if (informed_)
+        {
+          context.indexed_nodes.emplace_back(new_index);
+        }
 
-      map_copy->SetNodeState(new_node->node, NodeState::kVisited);
-      parent_child_map_[new_node->parent].push_back(new_node);
+      map_copy->SetNodeState(new_node, NodeState::kVisited);
+      clock.Lap(stats.nearest_neighbor_time);
 
-      CheckIfGoalReached(new_node, final, goal_node);
+      CheckIfGoalReached(new_index, goal_node, map_copy, context);
 
-      if (!neighbor_vector.empty())
+      if (informed_)
         {
-          auto is_rewired{Rewire(new_node, neighbor_vector, map_copy)};
-          if (is_rewired && final != std::nullptr_t() &&
-              current_cost > final->cost.f)
-            {
-              current_cost = final->cost.f;
-              std::cout << "Goal cost: " << final->cost.f << "\t";
-
-              auto end_time{std::chrono::high_resolution_clock::now()};
-              std::cout
-                  << "Time: "
-                  << std::chrono::duration_cast<std::chrono::milliseconds>(
-                         end_time - start_time)
-                         .count()
-                  << " ms" << std::endl;
-            }
+          // Neighbors of the random node can be up to twice the radius from
+          // the new node. The informed bound needs shorter rewire edges.
+          GetNearestNodeIndices(neighbor_radius_, new_node, spatial_hash_grid,
+                                kd_tree, neighbor_indices);
+          stats.neighbor_queries++;
+        }
+      if (!neighbor_indices.empty())
+        {
+          Rewire(new_index, map_copy, context);
+        }
+      // A goal path that cannot be repaired is dropped, a later goal node
+      // replaces it.
+      if (lazy_collision_checking_ && context.goal_index != kInvalidNodeIndex &&
+          !ValidatePath(context.goal_index, map_copy, context))
+        {
+          context.template SetGoal<Logging>(kInvalidNodeIndex);
+        }
+      clock.Lap(stats.rewire_time);
+
+      if (informed_ && context.goal_index != kInvalidNodeIndex &&
+          tree.GetCost(context.goal_index).f <
+              context.pruned_cost * (1.0 - prune_threshold_))
+        {
+          context.pruned_cost = tree.GetCost(context.goal_index).f;
+          Prune(context);
+          clock.Lap(stats.nearest_neighbor_time);
+        }
+    }
+  return PlanningStatus::kRunning;
+}
+
+template <typename Logging>
+bool BasicRRTStar<Logging>::WireNodeIfPossible(const Node &random_node,
+                                               const std::shared_ptr<Map> map,
+                                               Node &new_node,
+                                               NodeIndex &parent_index,
+                                               Context &context) const
+{
+  for (const auto neighbor_index : context.neighbor_indices)
+    {
+      const auto neighbor_node{context.tree.GetNode(neighbor_index)};
+      if (SteerNode(max_branch_length_, min_branch_length_, random_node,
+                    neighbor_node, new_node) &&
+          IsEdgeFree(neighbor_node, new_node, map, context))
+        {
+          parent_index = neighbor_index;
+          return true;
         }
     }
-  return ReconstructPath(final);
+
+  return false;
 }
 
-std::shared_ptr<NodeParent> RRTStar::WireNodeIfPossible(
-    const Node &random_node,
-    std::vector<std::shared_ptr<NodeParent>> neighbor_vector,
-    const std::shared_ptr<Map> map)
+template <typename Logging>
+bool
+BasicRRTStar<Logging>::LazyWireNodeIfPossible(const Node &random_node,
+                                              const std::shared_ptr<Map> map,
+                                              Node &new_node,
+                                              NodeIndex &parent_index,
+                                              Context &context) const
 {
-  std::shared_ptr<NodeParent> new_node{std::nullptr_t()};
-  auto neighbor_iterator = neighbor_vector.begin();
-  while (new_node == nullptr && neighbor_iterator != neighbor_vector.end())
+  // Cost through every neighbor is known without steering or a ray cast.
+  // Neighbors are then checked cheapest first, usually only the first one is
+  // cast.
+  constexpr auto kRejected{std::numeric_limits<double>::max()};
+  const auto &tree{context.tree};
+  const auto &neighbor_indices{context.neighbor_indices};
+  auto &candidate_costs{context.candidate_costs};
+  candidate_costs.resize(neighbor_indices.size());
+  for (auto i = 0u; i < neighbor_indices.size(); i++)
     {
-      new_node = WireNewNode(max_branch_length_, min_branch_length_,
-                             random_node, (*neighbor_iterator), map);
-      neighbor_iterator++;
+      const auto distance{
+          EuclideanDistance(random_node, tree.GetNode(neighbor_indices[i]))};
+      candidate_costs[i] =
+          distance < min_branch_length_
+              ? kRejected
+              : tree.GetCost(neighbor_indices[i]).f + 1.0 +
+                    std::min(distance,
+                             static_cast<double>(max_branch_length_));
     }
 
-  return new_node;
+  while (!candidate_costs.empty())
+    {
+      auto best{
+          std::min_element(candidate_costs.begin(), candidate_costs.end())};
+      if (*best == kRejected)
+        {
+          return false;
+        }
+      *best = kRejected;
+      const auto neighbor_index{
+          neighbor_indices[best - candidate_costs.begin()]};
+      const auto neighbor_node{tree.GetNode(neighbor_index)};
+      if (SteerNode(max_branch_length_, min_branch_length_, random_node,
+                    neighbor_node, new_node) &&
+          IsEdgeFree(neighbor_node, new_node, map, context))
+        {
+          parent_index = neighbor_index;
+          return true;
+        }
+    }
+
+  return false;
 }
 
-void RRTStar::CheckIfGoalReached(const std::shared_ptr<NodeParent> &new_node,
-                                 std::shared_ptr<NodeParent> &final,
-                                 const Node &goal_node)
+template <typename Logging>
+bool BasicRRTStar<Logging>::IsEdgeFree(const Node &src, const Node &dst,
+                                       const std::shared_ptr<Map> map,
+                                       Context &context) const
 {
-  auto remaining_distance{EuclideanDistance(new_node->node, goal_node)};
+  context.stats.collision_checks++;
+  return !CheckIfCollisionBetweenNodes(src, dst, map);
+}
+
+template <typename Logging>
+bool BasicRRTStar<Logging>::IsEdgeFree(const NodeIndex parent,
+                                       const NodeIndex child,
+                                       const std::shared_ptr<Map> map,
+                                       Context &context) const
+{
+  const auto key{(static_cast<std::uint64_t>(parent) << 32) | child};
+  const auto [edge, is_new] = context.checked_edges.try_emplace(key, false);
+  if (is_new)
+    {
+      edge->second = IsEdgeFree(context.tree.GetNode(parent),
+                                context.tree.GetNode(child), map, context);
+    }
+  return edge->second;
+}
+
+template <typename Logging>
+void BasicRRTStar<Logging>::CheckIfGoalReached(const NodeIndex new_index,
+                                               const Node &goal_node,
+                                               const std::shared_ptr<Map> map,
+                                               Context &context) const
+{
+  auto &tree{context.tree};
+  auto remaining_distance{
+      EuclideanDistance(tree.GetNode(new_index), goal_node)};
   if (remaining_distance < goal_radius_)
     {
-      std::lock_guard<std::mutex> lock(log_mutex_);
-      auto goal{std::make_shared<NodeParent>(
-          goal_node, new_node,
-          Cost(new_node->cost.g + 1, new_node->cost.h + remaining_distance))};
+      const auto &new_cost{tree.GetCost(new_index)};
+      auto goal_cost{Cost(new_cost.g + 1, new_cost.h + remaining_distance)};
 
-      if (final != std::nullptr_t())
+      if (context.goal_index == kInvalidNodeIndex ||
+          goal_cost.f < tree.GetCost(context.goal_index).f)
         {
-          if (goal->cost.f < final->cost.f)
+          // Repairing lazy rewires above the new goal can make it costlier
+          // than the current one.
+          const auto goal_index{
+              AddTreeNode(goal_node, new_index, goal_cost, context)};
+          if (!lazy_collision_checking_ ||
+              (ValidatePath(goal_index, map, context) &&
+               (context.goal_index == kInvalidNodeIndex ||
+                tree.GetCost(goal_index).f <
+                    tree.GetCost(context.goal_index).f)))
             {
-              final = goal;
-              log_.first.push_back(final);
-              std::cout << "Path changed." << std::endl;
+              context.template SetGoal<Logging>(goal_index);
             }
         }
-      else
-        {
-          final = goal;
-          log_.first.push_back(final);
-          log_.second = final;
-          std::cout << "Path found." << std::endl;
-        }
     }
 }
 
-bool RRTStar::Rewire(const std::shared_ptr<NodeParent> &new_node,
-                     std::vector<std::shared_ptr<NodeParent>> &nearest_nodes,
-                     const std::shared_ptr<Map> map)
+template <typename Logging>
+bool BasicRRTStar<Logging>::Rewire(const NodeIndex new_index,
+                                   const std::shared_ptr<Map> map,
+                                   Context &context) const
 {
   bool rewired{false};
-  for (const auto &nearest : nearest_nodes)
+  auto &tree{context.tree};
+  const auto new_node{tree.GetNode(new_index)};
+  const auto new_node_cost{tree.GetCost(new_index)};
+  for (const auto nearest_index : context.neighbor_indices)
     {
-      if (nearest->node == new_node->parent->node)
+      if (nearest_index == tree.GetParent(new_index))
         {
           continue;
         }
 
-      auto new_cost{Cost(new_node->cost.g + 1,
-                         new_node->cost.h +
-                             EuclideanDistance(new_node->node, nearest->node))};
+      auto nearest_node{tree.GetNode(nearest_index)};
+      auto new_cost{Cost(new_node_cost.g + 1,
+                         new_node_cost.h +
+                             EuclideanDistance(new_node, nearest_node))};
 
-      if (new_cost.f < nearest->cost.f)
+      if (new_cost.f < tree.GetCost(nearest_index).f)
         {
-          if (!CheckIfCollisionBetweenNodes(new_node->node, nearest->node, map))
+          // Cast from the new parent to its child, like parent edges. Lazy
+          // rewires are cast once they are on the goal path.
+          if (lazy_collision_checking_ ||
+              IsEdgeFree(new_node, nearest_node, map, context))
             {
-              parent_child_map_[nearest->parent].erase(
-                  std::remove(parent_child_map_[nearest->parent].begin(),
-                              parent_child_map_[nearest->parent].end(),
-                              nearest),
-                  parent_child_map_[nearest->parent].end());
-
-              nearest->parent = new_node;
-              nearest->cost = new_cost;
-              parent_child_map_[new_node].push_back(nearest);
-              IterativelyCostUpdate(nearest);
+              context.template SetParent<Logging>(nearest_index, new_index,
+                                                  new_cost);
+              IterativelyCostUpdate(nearest_index, context);
 
               rewired = true;
             }
@@ -181,31 +397,164 @@ bool RRTStar::Rewire(const std::shared_ptr<NodeParent> &new_node,
   return rewired;
 }
 
-void RRTStar::IterativelyCostUpdate(const std::shared_ptr<NodeParent> &node)
+template <typename Logging>
+void BasicRRTStar<Logging>::IterativelyCostUpdate(const NodeIndex index,
+                                                  Context &context) const
 {
-  std::queue<std::shared_ptr<NodeParent>> queue;
-  queue.push(node);
+  auto &tree{context.tree};
+  auto &update_stack{context.update_stack};
+  update_stack.clear();
+  update_stack.push_back(index);
+  while (!update_stack.empty())
+    {
+      auto parent{update_stack.back()};
+      update_stack.pop_back();
 
-  auto update_cost = [&](std::shared_ptr<NodeParent> current_node) {
-    std::for_each(
-        parent_child_map_[current_node].begin(),
-        parent_child_map_[current_node].end(), [&](const auto &child) {
-          child->cost =
-              Cost(child->parent->cost.g + 1,
-                   child->parent->cost.h +
-                       EuclideanDistance(child->node, child->parent->node));
-          queue.push(child);
-        });
-  };
+      const auto parent_node{tree.GetNode(parent)};
+      const auto parent_cost{tree.GetCost(parent)};
+      for (auto child = tree.GetFirstChild(parent);
+           child != kInvalidNodeIndex; child = tree.GetNextSibling(child))
+        {
+          context.template SetCost<Logging>(
+              child, Cost(parent_cost.g + 1,
+                          parent_cost.h + EuclideanDistance(tree.GetNode(child),
+                                                            parent_node)));
+          update_stack.push_back(child);
+        }
+    }
+}
 
-  while (!queue.empty())
+template <typename Logging>
+NodeIndex BasicRRTStar<Logging>::AddTreeNode(const Node &node,
+                                             const NodeIndex parent,
+                                             const Cost &cost,
+                                             Context &context) const
+{
+  context.checked_parents.push_back(parent);
+  return context.template AddNode<Logging>(node, parent, cost);
+}
+
+template <typename Logging>
+bool BasicRRTStar<Logging>::ValidatePath(const NodeIndex index,
+                                         const std::shared_ptr<Map> map,
+                                         Context &context) const
+{
+  // Every repaired node gets a checked parent, so the walk always moves up.
+  const auto &tree{context.tree};
+  auto &checked_parents{context.checked_parents};
+  auto child{index};
+  while (tree.GetParent(child) != kInvalidNodeIndex)
+    {
+      const auto parent{tree.GetParent(child)};
+      if (checked_parents[child] == parent ||
+          IsEdgeFree(parent, child, map, context))
+        {
+          checked_parents[child] = parent;
+          child = parent;
+        }
+      else if (!RepairParent(child, map, context))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+template <typename Logging>
+bool BasicRRTStar<Logging>::RepairParent(const NodeIndex index,
+                                         const std::shared_ptr<Map> map,
+                                         Context &context) const
+{
+  // The checked parent is restored unless it has been rewired below index
+  // since. Otherwise the cheapest neighbor outside the subtree of index with
+  // a free edge takes it.
+  const auto &tree{context.tree};
+  const auto is_in_subtree{[&tree, index](NodeIndex node) {
+    for (; node != kInvalidNodeIndex; node = tree.GetParent(node))
+      {
+        if (node == index)
+          {
+            return true;
+          }
+      }
+    return false;
+  }};
+
+  auto parent{context.checked_parents[index]};
+  if (is_in_subtree(parent))
     {
-      auto current_node{queue.front()};
-      queue.pop();
+      auto &repair_indices{context.repair_indices};
+      GetNearestNodeIndices(neighbor_radius_, tree.GetNode(index),
+                            *context.spatial_hash_grid, context.kd_tree,
+                            repair_indices);
+      context.stats.neighbor_queries++;
+      SortNodeIndicesByCost(tree, repair_indices);
+      const auto candidate{std::find_if(
+          repair_indices.begin(), repair_indices.end(),
+          [&](const NodeIndex node) {
+            return node != tree.GetParent(index) && !is_in_subtree(node) &&
+                   IsEdgeFree(node, index, map, context);
+          })};
+      if (candidate == repair_indices.end())
+        {
+          return false;
+        }
+      parent = *candidate;
+    }
+
+  const auto parent_cost{tree.GetCost(parent)};
+  context.template SetParent<Logging>(
+      index, parent,
+      Cost(parent_cost.g + 1,
+           parent_cost.h +
+               EuclideanDistance(tree.GetNode(index), tree.GetNode(parent))));
+  context.checked_parents[index] = parent;
+  IterativelyCostUpdate(index, context);
+  return true;
+}
+
+template <typename Logging>
+double BasicRRTStar<Logging>::GetInformedDiameter(Context &context) const
+{
+  // Every edge is at most max_edge long and adds 1 to g, so a path of length
+  // d costs at least d * (1 + 1 / max_edge). A parent edge is steered to max
+  // branch length and rounding adds less than sqrt(2). Informed mode rewires
+  // within neighbor radius of the new node. Goal edges are within goal
+  // radius.
+  const auto max_edge{std::max({max_branch_length_ + std::sqrt(2.0),
+                                static_cast<double>(neighbor_radius_),
+                                static_cast<double>(goal_radius_)})};
+  return context.tree.GetCost(context.goal_index).f * max_edge /
+         (max_edge + 1.0);
+}
 
-      update_cost(current_node);
+template <typename Logging>
+void BasicRRTStar<Logging>::Prune(Context &context) const
+{
+  // Nodes outside the informed ellipse cannot be on a better path, whatever
+  // their current cost is. Root is always kept.
+  const auto diameter{GetInformedDiameter(context)};
+  auto &indexed_nodes{context.indexed_nodes};
+  context.kd_tree.Clear();
+  auto kept{indexed_nodes.begin()};
+  for (const auto index : indexed_nodes)
+    {
+      const auto node{context.tree.GetNode(index)};
+      if (index != 0 && EuclideanDistance(context.start_node, node) +
+                                EuclideanDistance(node, context.goal_node) >
+                            diameter)
+        {
+          context.spatial_hash_grid->Remove(node, index);
+          continue;
+        }
+      context.kd_tree.Insert(node, index);
+      *kept++ = index;
     }
+  indexed_nodes.erase(kept, indexed_nodes.end());
 }
 
+template class BasicRRTStar<ExpansionLogging>;
+template class BasicRRTStar<NoLogging>;
+
 } // namespace tree_base
 } // namespace planning
@@ -14,8 +14,12 @@
 
 #include "utility/common_tree_base.h"
 #include "utility/i_planning.h"
+#include "utility/termination_condition.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <mutex>
+#include <random>
 #include <unordered_map>
 #include <vector>
 namespace planning
@@ -25,53 +29,144 @@ namespace tree_base
 
 /**
  * @brief Rapidly-exploring Random Tree (RRT) algorithm.
+ * Logging is ExpansionLogging or NoLogging.
  *
  */
-class RRTStar : public IPlanningWithLogging
+template <typename Logging> class BasicRRTStar : public PlanningWithContext
 {
 public:
-  RRTStar() {}
-  RRTStar(const int max_iteration) : max_iteration_(max_iteration) {}
-  RRTStar(const int max_iteration, const int max_branch_length,
-          const int min_branch_length, const int neighbor_radius,
-          const int goal_radius)
+  BasicRRTStar() {}
+  BasicRRTStar(const int max_iteration) : max_iteration_(max_iteration) {}
+  BasicRRTStar(const int max_iteration, const int max_branch_length,
+               const int min_branch_length, const int neighbor_radius,
+               const int goal_radius)
       : max_iteration_(max_iteration), max_branch_length_(max_branch_length),
         min_branch_length_(min_branch_length),
         neighbor_radius_(neighbor_radius), goal_radius_(goal_radius)
   {
   }
-  ~RRTStar() {}
-  Path FindPath(const Node &start_node, const Node &goal_node,
-                const std::shared_ptr<Map> map) override;
-  Log GetLog() override
+  ~BasicRRTStar() {}
+  std::unique_ptr<PlanningContext> CreateContext() const override;
+  void Begin(const Node &start_node, const Node &goal_node,
+             const std::shared_ptr<Map> map,
+             PlanningContext &context) const override;
+  PlanningStatus Step(const std::size_t iterations,
+                      PlanningContext &context) const override;
+
+  /**
+   * @brief Seed of the sampler. Every FindPath call restarts from this seed,
+   * so the same seed and map give the same tree.
+   *
+   */
+  void SetSeed(const std::uint64_t seed) { seed_ = seed; }
+
+  /**
+   * @brief Informed RRT*. Once a path is found, samples are drawn from the
+   * start/goal ellipse of the nodes that could still improve it, and tree
+   * nodes that cannot are pruned from the neighbor search.
+   *
+   */
+  void SetInformed(const bool informed) { informed_ = informed; }
+
+  /**
+   * @brief Parent candidates are ranked by the cost through them before any
+   * collision check, so only the chosen edge and the ones ranked above it are
+   * ray cast. Rewires are made without a ray cast. Edges are cast once they
+   * are on the path to the goal, and a blocked one is undone. Results are
+   * cached per parent and child, so no pair is cast twice.
+   *
+   */
+  void SetLazyCollisionChecking(const bool lazy_collision_checking)
   {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    return log_;
+    lazy_collision_checking_ = lazy_collision_checking;
   }
-  void ClearLog() override
+
+  /**
+   * @brief Rules that end FindPath before max iteration, e.g. a time budget
+   * or a cost that stopped improving. Checked once per iteration.
+   *
+   */
+  void SetTerminationCondition(const TerminationCondition &termination)
   {
-    std::lock_guard<std::mutex> lock(log_mutex_);
-    log_.first.clear();
-    log_.second = nullptr;
+    termination_ = termination;
   }
 
+  /**
+   * @brief Probability of sampling the goal node instead of a random node.
+   *
+   */
+  void SetGoalBias(const double goal_bias) { goal_bias_ = goal_bias; }
+
+  /**
+   * @brief Ray casts done by the last FindPath call without a context.
+   *
+   */
+  std::size_t GetCollisionCheckCount() const;
+
+  /**
+   * @brief Ray casts done by the last query run with context.
+   *
+   */
+  static std::size_t GetCollisionCheckCount(const PlanningContext &context);
+
 private:
-  std::shared_ptr<NodeParent>
-  WireNodeIfPossible(const Node &random_node,
-                     std::vector<std::shared_ptr<NodeParent>>,
-                     const std::shared_ptr<Map> map);
-  void CheckIfGoalReached(const std::shared_ptr<NodeParent> &new_node,
-                          std::shared_ptr<NodeParent> &final,
-                          const Node &goal_node);
-  bool Rewire(const std::shared_ptr<NodeParent> &new_node,
-              std::vector<std::shared_ptr<NodeParent>> &nearest_nodes,
-              const std::shared_ptr<Map> map);
-  void IterativelyCostUpdate(const std::shared_ptr<NodeParent> &node);
-
-  Log log_;
-  std::unordered_map<std::shared_ptr<NodeParent>,
-                     std::vector<std::shared_ptr<NodeParent>>>
-      parent_child_map_{};
+  /**
+   * @brief Tree, scratch buffers and progress of one query.
+   *
+   */
+  class Context : public TreePlanningContext
+  {
+  public:
+    std::unique_ptr<Sampler> sampler{};
+    std::unique_ptr<SpatialHashGrid> spatial_hash_grid{};
+    Node start_node{};
+    Node goal_node{};
+    int iteration{0};
+    // Goal cost at the last prune, only used by informed mode.
+    double pruned_cost{0.0};
+    std::vector<NodeIndex> neighbor_indices{};
+    std::vector<NodeIndex> update_stack{};
+    // Nodes in the neighbor search, only used by informed mode.
+    std::vector<NodeIndex> indexed_nodes{};
+    // Cost through each neighbor, only used with lazy collision checking.
+    std::vector<double> candidate_costs{};
+    // Parent each node was last checked against, only read with lazy
+    // collision checking. A node is added with a checked parent.
+    std::vector<NodeIndex> checked_parents{};
+    // Collision free flag per parent and child pair of rewire edges.
+    std::unordered_map<std::uint64_t, bool> checked_edges{};
+    // Parent candidates of a node whose rewire was undone.
+    std::vector<NodeIndex> repair_indices{};
+    // Copy of the planner rules, started by each query.
+    TerminationCondition termination{};
+  }; // class Context
+
+  bool WireNodeIfPossible(const Node &random_node,
+                          const std::shared_ptr<Map> map, Node &new_node,
+                          NodeIndex &parent_index, Context &context) const;
+  bool LazyWireNodeIfPossible(const Node &random_node,
+                              const std::shared_ptr<Map> map, Node &new_node,
+                              NodeIndex &parent_index, Context &context) const;
+  bool IsEdgeFree(const Node &src, const Node &dst,
+                  const std::shared_ptr<Map> map, Context &context) const;
+  bool IsEdgeFree(const NodeIndex parent, const NodeIndex child,
+                  const std::shared_ptr<Map> map, Context &context) const;
+  void CheckIfGoalReached(const NodeIndex new_index, const Node &goal_node,
+                          const std::shared_ptr<Map> map,
+                          Context &context) const;
+  bool Rewire(const NodeIndex new_index, const std::shared_ptr<Map> map,
+              Context &context) const;
+  void IterativelyCostUpdate(const NodeIndex index, Context &context) const;
+  NodeIndex AddTreeNode(const Node &node, const NodeIndex parent,
+                        const Cost &cost, Context &context) const;
+  bool ValidatePath(const NodeIndex index, const std::shared_ptr<Map> map,
+                    Context &context) const;
+  bool RepairParent(const NodeIndex index, const std::shared_ptr<Map> map,
+                    Context &context) const;
+  double GetInformedDiameter(Context &context) const;
+  void Prune(Context &context) const;
+
+  TerminationCondition termination_{};
 
   int max_iteration_{10000};
   int max_branch_length_{10};
@@ -79,9 +174,16 @@ private:
   int neighbor_radius_{15};
   int goal_radius_{5};
   int save_log_interval_{100};
-  std::mutex log_mutex_;
+  bool informed_{false};
+  bool lazy_collision_checking_{false};
+  double goal_bias_{0.0};
+  // Informed mode prunes when the goal cost drops by this fraction.
+  double prune_threshold_{0.01};
+  std::uint64_t seed_{std::random_device{}()};
 };
 
+using RRTStar = BasicRRTStar<ExpansionLogging>;
+
 } // namespace tree_base
 } // namespace planning
 
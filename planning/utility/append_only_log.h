@@ -0,0 +1,112 @@
+/**
+ * @file append_only_log.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Lock-free log with one writer and any number of readers.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_APPEND_ONLY_LOG_H_
+#define PLANNING_INCLUDE_APPEND_ONLY_LOG_H_
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+
+/**
+ * @brief Entries are only appended, by a single writer, and never move. Chunk
+ * k holds kFirstChunkSize << k entries, so appending never copies and an
+ * index is found in a few shifts. Readers keep the index they have read up to
+ * and only copy newer entries; neither side ever waits for the other.
+ */
+template <typename T> class AppendOnlyLog
+{
+public:
+  AppendOnlyLog() = default;
+  ~AppendOnlyLog()
+  {
+    for (auto &chunk : chunks_)
+      {
+        delete[] chunk.load(std::memory_order_relaxed);
+      }
+  }
+
+  AppendOnlyLog(const AppendOnlyLog &) = delete;
+  AppendOnlyLog &operator=(const AppendOnlyLog &) = delete;
+
+  /**
+   * @brief Only one thread may append.
+   *
+   */
+  void Append(const T &value)
+  {
+    const auto size{size_.load(std::memory_order_relaxed)};
+    std::size_t offset;
+    auto &chunk{chunks_[Locate(size, offset)]};
+    auto *entries{chunk.load(std::memory_order_relaxed)};
+    if (entries == nullptr)
+      {
+        // Published to readers by the size store below.
+        entries = new T[kFirstChunkSize << (&chunk - chunks_.data())];
+        chunk.store(entries, std::memory_order_relaxed);
+      }
+    entries[offset] = value;
+    size_.store(size + 1, std::memory_order_release);
+  }
+
+  std::size_t Size() const { return size_.load(std::memory_order_acquire); }
+
+  /**
+   * @brief Append the entries from cursor on to out. Safe while the writer
+   * appends.
+   *
+   * @return Cursor for the next read.
+   */
+  std::size_t Read(const std::size_t cursor, std::vector<T> &out) const
+  {
+    const auto size{Size()};
+    for (auto index = cursor; index < size;)
+      {
+        std::size_t offset;
+        const auto chunk{Locate(index, offset)};
+        const auto *entries{chunks_[chunk].load(std::memory_order_relaxed)};
+        const auto end{std::min(size - index + offset,
+                                kFirstChunkSize << chunk)};
+        out.insert(out.end(), entries + offset, entries + end);
+        index += end - offset;
+      }
+    return size;
+  }
+
+private:
+  static constexpr std::size_t kFirstChunkSize{256};
+  static constexpr std::size_t kMaxChunkCount{48};
+
+  // Chunk k starts at kFirstChunkSize * (2^k - 1).
+  static std::size_t Locate(const std::size_t index, std::size_t &offset)
+  {
+    const auto scaled{index / kFirstChunkSize + 1};
+    std::size_t chunk{0};
+    while ((scaled >> (chunk + 1)) != 0)
+      {
+        chunk++;
+      }
+    offset = index - kFirstChunkSize * ((std::size_t{1} << chunk) - 1);
+    return chunk;
+  }
+
+  std::array<std::atomic<T *>, kMaxChunkCount> chunks_{};
+  std::atomic<std::size_t> size_{0};
+}; // class AppendOnlyLog
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_APPEND_ONLY_LOG_H_ */
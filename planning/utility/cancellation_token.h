@@ -0,0 +1,82 @@
+/**
+ * @file cancellation_token.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Flag and deadline to abandon a running query from another thread.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_CANCELLATION_TOKEN_H_
+#define PLANNING_INCLUDE_CANCELLATION_TOKEN_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace planning
+{
+
+/**
+ * @brief Shared between the caller and the queries it may abandon. Once
+ * cancelled it stays cancelled, use a new token for the next query.
+ */
+class CancellationToken
+{
+public:
+  void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+  bool IsCancelled() const
+  {
+    return cancelled_.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::atomic<bool> cancelled_{false};
+}; // class CancellationToken
+
+/**
+ * @brief Token and deadline of one query. Null token and time_point::max
+ * disable each rule. Every thread of a query checks its own copy.
+ */
+class StopCondition
+{
+public:
+  StopCondition() {}
+  StopCondition(std::shared_ptr<const CancellationToken> token,
+                const std::chrono::steady_clock::time_point deadline)
+      : token_(std::move(token)), deadline_(deadline)
+  {
+  }
+
+  /**
+   * @brief Checked once per planner iteration. Token is a relaxed load, the
+   * clock is only read every kDeadlineCheckInterval calls.
+   *
+   */
+  bool ShouldStop()
+  {
+    if (token_ != nullptr && token_->IsCancelled())
+      {
+        return true;
+      }
+    return deadline_ != std::chrono::steady_clock::time_point::max() &&
+           ++checks_ % kDeadlineCheckInterval == 0 &&
+           std::chrono::steady_clock::now() >= deadline_;
+  }
+
+private:
+  static constexpr std::uint32_t kDeadlineCheckInterval{32};
+
+  std::shared_ptr<const CancellationToken> token_{};
+  std::chrono::steady_clock::time_point deadline_{
+      std::chrono::steady_clock::time_point::max()};
+  std::uint32_t checks_{0};
+}; // class StopCondition
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_CANCELLATION_TOKEN_H_ */
@@ -10,6 +10,11 @@
  */
 
 #include "common_grid_base.h"
+#include "search_trace.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
 
 namespace planning
 {
@@ -23,5 +28,48 @@ SearchSpace GetEightDirection()
   return {{0, 1}, {1, 0}, {0, -1}, {-1, 0}, {1, 1}, {1, -1}, {-1, -1}, {-1, 1}};
 }
 
+void GridPlanningContext::ReadLog(LogCursor &cursor, Log &log) const
+{
+  const auto current{std::atomic_load(&log_)};
+  if (cursor.source != current)
+    {
+      cursor = LogCursor{current, 0};
+      log = Log{};
+    }
+  // Goal is published after its expansion, so it is read first.
+  const auto has_goal{current->has_goal.load(std::memory_order_acquire)};
+  cursor.index = current->expanded.Read(cursor.index, log.first);
+  if (has_goal)
+    {
+      log.second = current->goal;
+    }
+}
+
+void GridPlanningContext::ReadTrace(LogCursor &cursor,
+                                    SearchTraceWriter &trace) const
+{
+  const auto current{std::atomic_load(&log_)};
+  if (cursor.source != current)
+    {
+      cursor = LogCursor{current, 0};
+    }
+  std::vector<std::shared_ptr<NodeParent>> expanded;
+  cursor.index = current->expanded.Read(cursor.index, expanded);
+  for (const auto &node_parent : expanded)
+    {
+      trace.AddExpansion(node_parent->node);
+    }
+}
+
+void GridPlanningContext::ClearLog()
+{
+  // An empty log is kept, so queries without logging never allocate one.
+  if (log_->expanded.Size() != 0 ||
+      log_->has_goal.load(std::memory_order_relaxed))
+    {
+      std::atomic_store(&log_, std::make_shared<ExpansionLog>());
+    }
+}
+
 } // namespace grid_base
 } // namespace planning
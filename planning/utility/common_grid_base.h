@@ -12,11 +12,15 @@
 #ifndef PLANNING_GRID_BASE_INCLUDE_COMMON_GRID_BASE_H_
 #define PLANNING_GRID_BASE_INCLUDE_COMMON_GRID_BASE_H_
 
+#include "append_only_log.h"
 #include "common_planning.h"
 #include "data_types.h"
+#include "i_planning.h"
 
 #include <array>
+#include <atomic>
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace planning
@@ -31,6 +35,67 @@ SearchSpace GetFourDirection();
 
 SearchSpace GetEightDirection();
 
+/**
+ * @brief Context of the grid planners. Holds a scratch copy of the map for
+ * visited marks and the expanded nodes as log.
+ */
+class GridPlanningContext : public PlanningContext
+{
+public:
+  void ReadLog(LogCursor &cursor, Log &log) const override;
+  void ReadTrace(LogCursor &cursor,
+                 SearchTraceWriter &trace) const override;
+
+  /**
+   * @brief Start an empty log for a new query. Readers of the previous log
+   * keep it until they read again.
+   *
+   */
+  void ClearLog();
+
+  /**
+   * @brief Compiled out unless Logging is enabled.
+   *
+   */
+  template <typename Logging>
+  void AddToLog(const std::shared_ptr<NodeParent> &node)
+  {
+    if constexpr (Logging::kEnabled)
+      {
+        if (logging_)
+          {
+            log_->expanded.Append(node);
+          }
+      }
+  }
+  template <typename Logging>
+  void SetGoalInLog(const std::shared_ptr<NodeParent> &node)
+  {
+    if constexpr (Logging::kEnabled)
+      {
+        if (logging_)
+          {
+            log_->goal = node;
+            log_->has_goal.store(true, std::memory_order_release);
+          }
+      }
+  }
+
+  std::shared_ptr<Map> map{std::make_shared<Map>(0, 0)};
+
+private:
+  struct ExpansionLog
+  {
+    AppendOnlyLog<std::shared_ptr<NodeParent>> expanded{};
+    // Set once, after the goal expansion is logged.
+    std::shared_ptr<NodeParent> goal{};
+    std::atomic<bool> has_goal{false};
+  };
+
+  // Only swapped with atomic_store so readers never wait for the query.
+  std::shared_ptr<ExpansionLog> log_{std::make_shared<ExpansionLog>()};
+}; // class GridPlanningContext
+
 } // namespace grid_base
 } // namespace planning
 
@@ -11,6 +11,8 @@
 
 #include "common_planning.h"
 
+#include <cmath>
+
 namespace planning
 {
 // Map
@@ -55,6 +57,33 @@ Map::Map(std::string &file_path)
         }
     }
 }
+Map::Map(const Map &map)
+    : height_(map.height_), width_(map.width_), map_(map.map_),
+      component_labels_(map.component_labels_),
+      free_nodes_(map.GetSharedFreeNodes())
+{
+}
+Map &Map::operator=(const Map &map)
+{
+  height_ = map.height_;
+  width_ = map.width_;
+  map_ = map.map_;
+  component_labels_ = map.component_labels_;
+  free_nodes_ = map.GetSharedFreeNodes();
+  return *this;
+}
+void Map::CopyCells(const Map &map)
+{
+  height_ = map.height_;
+  width_ = map.width_;
+  map_.resize(height_);
+  for (auto i = 0u; i < height_; i++)
+    {
+      map_[i].assign(map.map_[i].begin(), map.map_[i].end());
+    }
+  component_labels_ = nullptr;
+  free_nodes_ = map.GetSharedFreeNodes();
+}
 std::size_t Map::GetWidth() const { return width_; }
 std::size_t Map::GetHeight() const { return height_; }
 NodeState Map::GetNodeState(const Node &node) const
@@ -63,7 +92,25 @@ NodeState Map::GetNodeState(const Node &node) const
 }
 void Map::SetNodeState(const Node &node, NodeState node_state)
 {
+  auto was_occupied{map_[node.x_][node.y_] == NodeState::kOccupied};
+  if ((map_[node.x_][node.y_] == NodeState::kFree) !=
+      (node_state == NodeState::kFree))
+    {
+      free_nodes_ = nullptr;
+    }
   map_[node.x_][node.y_] = node_state;
+  if (component_labels_ != nullptr &&
+      was_occupied != (node_state == NodeState::kOccupied))
+    {
+      // Copies share labels, edit them in place only when this map is the
+      // last owner.
+      auto labels{component_labels_.use_count() == 1
+                      ? std::const_pointer_cast<ComponentLabels>(
+                            component_labels_)
+                      : std::make_shared<ComponentLabels>(*component_labels_)};
+      labels->Update(node, *this);
+      component_labels_ = labels;
+    }
 }
 void Map::Visualize() const
 {
@@ -83,6 +130,50 @@ void Map::UpdateMapWithPath(const Path &path)
     {
       map_[node.x_][node.y_] = NodeState::kPath;
     }
+  free_nodes_ = nullptr;
+}
+
+std::shared_ptr<const std::vector<Node>> Map::GetFreeNodes() const
+{
+  std::lock_guard<std::mutex> lock(free_nodes_mutex_);
+  if (free_nodes_ == nullptr)
+    {
+      auto free_nodes{std::make_shared<std::vector<Node>>()};
+      for (auto i = 0u; i < height_; i++)
+        {
+          for (auto j = 0u; j < width_; j++)
+            {
+              if (map_[i][j] == NodeState::kFree)
+                {
+                  free_nodes->emplace_back(i, j);
+                }
+            }
+        }
+      free_nodes_ = free_nodes;
+    }
+  return free_nodes_;
+}
+std::shared_ptr<const std::vector<Node>> Map::GetSharedFreeNodes() const
+{
+  std::lock_guard<std::mutex> lock(free_nodes_mutex_);
+  return free_nodes_;
+}
+
+void Map::EnableComponentLabels(const int search_space)
+{
+  auto labels{std::make_shared<ComponentLabels>(search_space)};
+  labels->Build(*this);
+  component_labels_ = labels;
+}
+bool Map::IsReachable(const Node &start_node, const Node &goal_node) const
+{
+  if (component_labels_ == nullptr ||
+      !component_labels_->IsLabeled(start_node) ||
+      !component_labels_->IsLabeled(goal_node))
+    {
+      return true;
+    }
+  return component_labels_->IsConnected(start_node, goal_node);
 }
 
 bool IsInbound(const Node &node, const std::shared_ptr<Map> map)
@@ -105,4 +196,72 @@ bool IsGoal(const Node &node, const Node &goal_node)
   return node.x_ == goal_node.x_ && node.y_ == goal_node.y_;
 }
 
+std::vector<Node> Get2DRayBetweenNodes(const Node &src, const Node &dst)
+{
+  if (src == dst)
+    {
+      return std::vector<Node>{};
+    }
+  std::pair<double, double> ray_vector{dst.x_ - src.x_, dst.y_ - src.y_};
+  auto ray_length{std::hypot(ray_vector.first, ray_vector.second)};
+  auto unit_vector{std::make_pair(ray_vector.first / ray_length,
+                                  ray_vector.second / ray_length)};
+  std::vector<Node> ray;
+
+  // Check ray vector corresponds which past of cartesian coordinate system.
+  std::pair<double, double> sign_vector{0.5, 0.5};
+  if (ray_vector.first < 0)
+    {
+      sign_vector.first = -0.5;
+    }
+  if (ray_vector.second < 0)
+    {
+      sign_vector.second = -0.5;
+    }
+
+  for (auto i = 0; i < ray_length; i++)
+    {
+      auto new_node_x{src.x_ + sign_vector.first + i * unit_vector.first};
+      auto new_node_y{src.y_ + sign_vector.second + i * unit_vector.second};
+      Node new_node{static_cast<int>(new_node_x), static_cast<int>(new_node_y)};
+      ray.emplace_back(new_node);
+    }
+
+  // check first and last node.
+  if (ray.front() != src)
+    {
+      ray.insert(ray.begin(), src);
+    }
+  if (ray.back() != dst)
+    {
+      ray.emplace_back(dst);
+    }
+
+  return ray;
+}
+
+double EuclideanDistance(const Node &node1, const Node &node2)
+{
+  return std::hypot(node1.x_ - node2.x_, node1.y_ - node2.y_);
+}
+
+bool CheckIfCollisionBetweenNodes(const Node &node1, const Node &node2,
+                                  const std::shared_ptr<Map> map)
+{
+  auto ray{Get2DRayBetweenNodes(node1, node2)};
+  if (ray.empty())
+    {
+      return true;
+    }
+  for (const auto &node : ray)
+    {
+      if (map->GetNodeState(node) == NodeState::kOccupied)
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
 } // namespace planning
@@ -12,6 +12,7 @@
 #ifndef PLANNING_INCLUDE_COMMON_PLANNING_H_
 #define PLANNING_INCLUDE_COMMON_PLANNING_H_
 
+#include "component_labels.h"
 #include "node_parent.h"
 
 #include <cstddef>
@@ -19,6 +20,7 @@
 #include <iostream>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -34,8 +36,17 @@ class Map
 public:
   Map(std::size_t height, std::size_t width);
   Map(std::string &file_path);
+  Map(const Map &map);
+  Map &operator=(const Map &map);
   ~Map() {}
 
+  /**
+   * @brief Copy size and cell states of map without its component labels.
+   * Reuses the storage of this map, so scratch copies do not allocate.
+   *
+   */
+  void CopyCells(const Map &map);
+
   std::size_t GetWidth() const;
   std::size_t GetHeight() const;
 
@@ -68,9 +79,39 @@ public:
    */
   void UpdateMapWithPath(const Path &path);
 
+  /**
+   * @brief Label connected free regions so planners can reject unreachable
+   * queries before searching. Labels are kept up to date by SetNodeState.
+   *
+   * @param search_space 4 or 8 connectivity.
+   */
+  void EnableComponentLabels(const int search_space);
+
+  /**
+   * @brief Check if goal may be reachable from start. Returns false only when
+   * labels are enabled, both nodes are free and they are in different regions.
+   *
+   */
+  bool IsReachable(const Node &start_node, const Node &goal_node) const;
+
+  /**
+   * @brief Free cells in row order, indexed on the first call and shared by
+   * copies of the map until a cell becomes free or stops being free. Safe to
+   * call from several threads while the map is not edited.
+   *
+   */
+  std::shared_ptr<const std::vector<Node>> GetFreeNodes() const;
+
 private:
+  std::shared_ptr<const std::vector<Node>> GetSharedFreeNodes() const;
+
   std::size_t height_, width_;
   std::vector<std::vector<NodeState>> map_;
+  // Shared by copies of the map, copied on the first edit of a copy.
+  std::shared_ptr<const ComponentLabels> component_labels_{};
+  // Built by GetFreeNodes, shared like the component labels.
+  mutable std::shared_ptr<const std::vector<Node>> free_nodes_{};
+  mutable std::mutex free_nodes_mutex_{};
 }; // class Map
 
 /**
@@ -91,5 +132,35 @@ bool IsFree(const Node &node, const std::shared_ptr<Map> map);
  */
 bool IsGoal(const Node &node, const Node &goal_node);
 
+/**
+ * @brief // Get 2D ray between two nodes
+ *
+ * @param node1
+ * @param node2
+ * @return std::vector<Node>
+ */
+std::vector<Node> Get2DRayBetweenNodes(const Node &node1, const Node &node2);
+
+/**
+ * @brief // Euclidean distance between two nodes
+ *
+ * @param node1
+ * @param node2
+ * @return double
+ */
+double EuclideanDistance(const Node &node1, const Node &node2);
+
+/**
+ * @brief Check if there is collision between two nodes
+ *
+ * @param node1
+ * @param node2
+ * @param map
+ * @return true if there is collision
+ * @return false if there is no collision
+ */
+bool CheckIfCollisionBetweenNodes(const Node &node1, const Node &node2,
+                                  const std::shared_ptr<Map> map);
+
 } // namespace planning
 #endif /* PLANNING_INCLUDE_COMMON_PLANNING_H_ */
@@ -10,10 +10,12 @@
  */
 
 #include "common_tree_base.h"
+#include "search_trace.h"
 
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <atomic>
 #include <memory>
 #include <random>
 namespace planning
@@ -23,11 +25,8 @@ namespace tree_base
 
 std::pair<double, double> RandomSampling()
 {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<> dis(0.0, 1.0);
-
-  return std::make_pair(dis(gen), dis(gen));
+  thread_local RandomGenerator generator(std::random_device{}());
+  return std::make_pair(generator.Uniform(), generator.Uniform());
 }
 
 Node RandomNode(const std::shared_ptr<Map> map)
@@ -48,74 +47,6 @@ Node RandomNode(const std::shared_ptr<Map> map)
   return random_node;
 }
 
-std::vector<Node> Get2DRayBetweenNodes(const Node &src, const Node &dst)
-{
-  if (src == dst)
-    {
-      return std::vector<Node>{};
-    }
-  std::pair<double, double> ray_vector{dst.x_ - src.x_, dst.y_ - src.y_};
-  auto ray_length{std::hypot(ray_vector.first, ray_vector.second)};
-  auto unit_vector{std::make_pair(ray_vector.first / ray_length,
-                                  ray_vector.second / ray_length)};
-  std::vector<Node> ray;
-
-  // Check ray vector corresponds which past of cartesian coordinate system.
-  std::pair<double, double> sign_vector{0.5, 0.5};
-  if (ray_vector.first < 0)
-    {
-      sign_vector.first = -0.5;
-    }
-  if (ray_vector.second < 0)
-    {
-      sign_vector.second = -0.5;
-    }
-
-  for (auto i = 0; i < ray_length; i++)
-    {
-      auto new_node_x{src.x_ + sign_vector.first + i * unit_vector.first};
-      auto new_node_y{src.y_ + sign_vector.second + i * unit_vector.second};
-      Node new_node{static_cast<int>(new_node_x), static_cast<int>(new_node_y)};
-      ray.emplace_back(new_node);
-    }
-
-  // check first and last node.
-  if (ray.front() != src)
-    {
-      ray.insert(ray.begin(), src);
-    }
-  if (ray.back() != dst)
-    {
-      ray.emplace_back(dst);
-    }
-
-  return ray;
-}
-
-double EuclideanDistance(const Node &node1, const Node &node2)
-{
-  return std::hypot(node1.x_ - node2.x_, node1.y_ - node2.y_);
-}
-
-bool CheckIfCollisionBetweenNodes(const Node &node1, const Node &node2,
-                                  const std::shared_ptr<Map> map)
-{
-  auto ray{Get2DRayBetweenNodes(node1, node2)};
-  if (ray.empty())
-    {
-      return true;
-    }
-  for (const auto &node : ray)
-    {
-      if (map->GetNodeState(node) == NodeState::kOccupied)
-        {
-          return true;
-        }
-    }
-
-  return false;
-}
-
 std::shared_ptr<NodeParent>
 GetNearestNodeParent(const Node &node,
                      const std::vector<std::shared_ptr<NodeParent>> &nodes)
@@ -158,32 +89,103 @@ std::vector<std::shared_ptr<NodeParent>> GetNearestNodeParentVector(
   return nearest_nodes;
 }
 
+std::vector<std::shared_ptr<NodeParent>> GetNearestNodeParentVector(
+    const int neighbor_radius, const Node &node,
+    const std::vector<std::shared_ptr<NodeParent>> &nodes,
+    const KDTree &kd_tree)
+{
+  std::vector<std::size_t> ids;
+  kd_tree.Radius(node, neighbor_radius, ids);
+  if (ids.empty())
+    {
+      ids.emplace_back(kd_tree.Nearest(node));
+    }
+
+  auto nearest_nodes = std::vector<std::shared_ptr<NodeParent>>{};
+  nearest_nodes.reserve(ids.size());
+  for (const auto id : ids)
+    {
+      nearest_nodes.emplace_back(nodes[id]);
+    }
+
+  std::sort(nearest_nodes.begin(), nearest_nodes.end(),
+            [](const std::shared_ptr<NodeParent> &node1,
+               const std::shared_ptr<NodeParent> &node2) {
+              return node1->cost.f < node2->cost.f;
+            });
+
+  return nearest_nodes;
+}
+
+void GetNearestNodeIndices(const int neighbor_radius, const Node &node,
+                           const SpatialHashGrid &spatial_hash_grid,
+                           const KDTree &kd_tree, std::vector<NodeIndex> &ids)
+{
+  spatial_hash_grid.Radius(node, neighbor_radius, ids);
+  if (ids.empty())
+    {
+      ids.emplace_back(kd_tree.Nearest(node));
+    }
+}
+
+void SortNodeIndicesByCost(const Tree &tree, std::vector<NodeIndex> &ids)
+{
+  std::sort(ids.begin(), ids.end(),
+            [&tree](const NodeIndex index1, const NodeIndex index2) {
+              return tree.GetCost(index1).f < tree.GetCost(index2).f;
+            });
+}
+
 std::shared_ptr<NodeParent>
 WireNewNode(const int max_branch_length, const int min_branch_length,
             const Node &random_node,
             const std::shared_ptr<NodeParent> &nearest_node,
             const std::shared_ptr<Map> map)
 {
-  double distance{EuclideanDistance(random_node, nearest_node->node)};
-  double unit_vector_x{(random_node.x_ - nearest_node->node.x_) / distance};
-  double unit_vector_y{(random_node.y_ - nearest_node->node.y_) / distance};
+  Node new_node;
+  if (!WireNewNode(max_branch_length, min_branch_length, random_node,
+                   nearest_node->node, map, new_node))
+    {
+      return std::nullptr_t();
+    }
+  return std::make_shared<NodeParent>(new_node, nearest_node, Cost{});
+}
 
-  Node new_node{random_node};
+bool SteerNode(const int max_branch_length, const int min_branch_length,
+               const Node &random_node, const Node &nearest_node,
+               Node &new_node)
+{
+  double distance{EuclideanDistance(random_node, nearest_node)};
+  double unit_vector_x{(random_node.x_ - nearest_node.x_) / distance};
+  double unit_vector_y{(random_node.y_ - nearest_node.y_) / distance};
+
+  new_node = random_node;
   if (distance > max_branch_length)
     {
-      new_node.x_ = nearest_node->node.x_ + max_branch_length * unit_vector_x;
-      new_node.y_ = nearest_node->node.y_ + max_branch_length * unit_vector_y;
-      distance = EuclideanDistance(new_node, nearest_node->node);
+      new_node.x_ = nearest_node.x_ + max_branch_length * unit_vector_x;
+      new_node.y_ = nearest_node.y_ + max_branch_length * unit_vector_y;
     }
   else if (distance < min_branch_length)
     {
-      return std::nullptr_t();
+      return false;
+    }
+  return true;
+}
+
+bool WireNewNode(const int max_branch_length, const int min_branch_length,
+                 const Node &random_node, const Node &nearest_node,
+                 const std::shared_ptr<Map> map, Node &new_node)
+{
+  if (!SteerNode(max_branch_length, min_branch_length, random_node,
+                 nearest_node, new_node))
+    {
+      return false;
     }
 
-  auto ray{Get2DRayBetweenNodes(nearest_node->node, new_node)};
+  auto ray{Get2DRayBetweenNodes(nearest_node, new_node)};
   if (ray.empty())
     {
-      return std::nullptr_t();
+      return false;
     }
   auto index{0u};
   while (index < ray.size() &&
@@ -193,23 +195,112 @@ WireNewNode(const int max_branch_length, const int min_branch_length,
     }
   if (index == ray.size())
     {
-      return std::make_shared<NodeParent>(new_node, nearest_node, Cost{});
+      return true;
     }
   if (index == 0)
     {
-      return std::nullptr_t();
+      return false;
     }
-  auto isLengthValid{EuclideanDistance(ray[index - 1], nearest_node->node) >
+  auto isLengthValid{EuclideanDistance(ray[index - 1], nearest_node) >
                      min_branch_length};
   auto isNodeValid{map->GetNodeState(ray[index]) != NodeState::kOccupied &&
                    ray[index] != new_node};
   if (isLengthValid && isNodeValid)
     {
-      return std::make_shared<NodeParent>(ray[index - 1], nearest_node, Cost{});
+      new_node = ray[index - 1];
+      return true;
     }
 
-  return std::nullptr_t();
+  return false;
 };
 
+void TreePlanningContext::ReadLog(LogCursor &cursor, Log &log) const
+{
+  const auto current{std::atomic_load(&log_)};
+  if (cursor.source != current)
+    {
+      cursor = LogCursor{current, 0};
+      log = Log{};
+    }
+  // Goal is published after its node, so it is read first.
+  const auto goal{current->goal_index.load(std::memory_order_acquire)};
+  std::vector<TreeLogEntry> entries;
+  cursor.index = current->entries.Read(cursor.index, entries);
+  auto &nodes{log.first};
+  for (const auto &entry : entries)
+    {
+      auto parent{entry.parent != kInvalidNodeIndex ? nodes[entry.parent]
+                                                    : nullptr};
+      if (entry.index == nodes.size())
+        {
+          nodes.emplace_back(
+              std::make_shared<NodeParent>(entry.node, parent, entry.cost));
+        }
+      else
+        {
+          nodes[entry.index]->parent = parent;
+          nodes[entry.index]->cost = entry.cost;
+        }
+    }
+  log.second = goal != kInvalidNodeIndex ? nodes[goal] : nullptr;
+}
+
+void TreePlanningContext::ReadTrace(LogCursor &cursor,
+                                    SearchTraceWriter &trace) const
+{
+  const auto current{std::atomic_load(&log_)};
+  if (cursor.source != current)
+    {
+      cursor = LogCursor{current, 0};
+    }
+  std::vector<TreeLogEntry> entries;
+  cursor.index = current->entries.Read(cursor.index, entries);
+  for (const auto &entry : entries)
+    {
+      // Traces only keep the tree shape.
+      if (entry.is_cost_update)
+        {
+          continue;
+        }
+      const auto parent{entry.parent != kInvalidNodeIndex ? entry.parent
+                                                          : kNoTraceParent};
+      if (entry.index == trace.GetNodeCount())
+        {
+          trace.AddEdge(entry.node, parent);
+        }
+      else
+        {
+          trace.AddRewire(entry.index, parent);
+        }
+    }
+}
+
+void TreePlanningContext::Clear()
+{
+  tree.Clear();
+  goal_index = kInvalidNodeIndex;
+  // An empty log is kept, so queries without logging never allocate one.
+  if (log_->entries.Size() != 0)
+    {
+      std::atomic_store(&log_, std::make_shared<TreeLog>());
+    }
+}
+
+void TreePlanningContext::AppendToLog(const TreeLogEntry &entry)
+{
+  if (logging_)
+    {
+      log_->entries.Append(entry);
+    }
+}
+
+void TreePlanningContext::PublishGoal(const NodeIndex index)
+{
+  if (logging_)
+    {
+      log_->goal_index.store(index, std::memory_order_release);
+    }
+}
+
 } // namespace tree_base
-} // namespace planning
\ No newline at end of file
+} // namespace planning
@@ -12,9 +12,16 @@
 #ifndef PLANNING_TREE_BASE_INCLUDE_COMMON_TREE_BASE_H_
 #define PLANNING_TREE_BASE_INCLUDE_COMMON_TREE_BASE_H_
 
+#include "append_only_log.h"
 #include "common_planning.h"
 #include "i_planning.h"
+#include "kd_tree.h"
+#include "random_generator.h"
+#include "sampler.h"
+#include "spatial_hash_grid.h"
+#include "tree.h"
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -26,49 +33,21 @@ namespace tree_base
 {
 
 /**
- * @brief // Random sampling function (x, y) between (0, 1)
+ * @brief // Random sampling function (x, y) between (0, 1). Uses a generator
+ * seeded once per thread; planners that need reproducible runs use Sampler.
  *
  */
 std::pair<double, double> RandomSampling();
 
 /**
- * @brief Random node from map
+ * @brief Random node from map, rejection sampled. See Sampler for sampling
+ * without rejections.
  *
  * @param map
  * @return Node
  */
 Node RandomNode(const std::shared_ptr<Map> map);
 
-/**
- * @brief // Get 2D ray between two nodes
- *
- * @param node1
- * @param node2
- * @return std::vector<Node>
- */
-std::vector<Node> Get2DRayBetweenNodes(const Node &node1, const Node &node2);
-
-/**
- * @brief // Euclidean distance between two nodes
- *
- * @param node1
- * @param node2
- * @return double
- */
-double EuclideanDistance(const Node &node1, const Node &node2);
-
-/**
- * @brief Check if there is collision between two nodes
- *
- * @param node1
- * @param node2
- * @param map
- * @return true if there is collision
- * @return false if there is no collision
- */
-bool CheckIfCollisionBetweenNodes(const Node &node1, const Node &node2,
-                                  const std::shared_ptr<Map> map);
-
 /**
  * @brief Get the Nearest Node Parent object
  *
@@ -94,6 +73,41 @@ std::vector<std::shared_ptr<NodeParent>> GetNearestNodeParentVector(
     const int neighbor_radius, const Node &node,
     const std::vector<std::shared_ptr<NodeParent>> &nodes);
 
+/**
+ * @brief Get the Nearest Node Parent Vector object by querying a KD-tree whose
+ * ids are indices of nodes.
+ *
+ * @param neighbor_radius
+ * @param node
+ * @param nodes
+ * @param kd_tree
+ * @return std::vector<std::shared_ptr<NodeParent>>
+ */
+std::vector<std::shared_ptr<NodeParent>> GetNearestNodeParentVector(
+    const int neighbor_radius, const Node &node,
+    const std::vector<std::shared_ptr<NodeParent>> &nodes,
+    const KDTree &kd_tree);
+
+/**
+ * @brief Fill ids with the tree nodes closer than neighbor_radius, found in the
+ * buckets around node. Falls back to the nearest node of the KD-tree.
+ *
+ * @param neighbor_radius
+ * @param node
+ * @param spatial_hash_grid Ids are indices of the tree.
+ * @param kd_tree Ids are indices of the tree.
+ * @param ids Result, reused across calls.
+ */
+void GetNearestNodeIndices(const int neighbor_radius, const Node &node,
+                           const SpatialHashGrid &spatial_hash_grid,
+                           const KDTree &kd_tree, std::vector<NodeIndex> &ids);
+
+/**
+ * @brief Sort ids by the cost of their tree nodes.
+ *
+ */
+void SortNodeIndicesByCost(const Tree &tree, std::vector<NodeIndex> &ids);
+
 /**
  * @brief Wire new node to nearest node if there is no collision.
  *
@@ -111,6 +125,132 @@ WireNewNode(const int max_branch_length, const int min_branch_length,
             const std::shared_ptr<NodeParent> &nearest_node,
             const std::shared_ptr<Map> map);
 
+/**
+ * @brief Move random node towards nearest node until it is at most max branch
+ * length away. Collision is not checked.
+ *
+ * @param new_node Steered node.
+ * @return false if random node is closer than min branch length.
+ */
+bool SteerNode(const int max_branch_length, const int min_branch_length,
+               const Node &random_node, const Node &nearest_node,
+               Node &new_node);
+
+/**
+ * @brief Wire new node to nearest node if there is no collision.
+ *
+ * @param max_branch_length
+ * @param min_branch_length
+ * @param random_node
+ * @param nearest_node
+ * @param map
+ * @param new_node Set if the node is wired.
+ * @return true if the node is wired.
+ */
+bool WireNewNode(const int max_branch_length, const int min_branch_length,
+                 const Node &random_node, const Node &nearest_node,
+                 const std::shared_ptr<Map> map, Node &new_node);
+
+/**
+ * @brief Node added to the tree, rewired, or given a new cost after one of
+ * its ancestors was rewired.
+ */
+struct TreeLogEntry
+{
+  Node node{};
+  NodeIndex index{kInvalidNodeIndex};
+  NodeIndex parent{kInvalidNodeIndex};
+  Cost cost{};
+  // Only the cost changed, parent is the current one.
+  bool is_cost_update{false};
+};
+
+/**
+ * @brief Context of the tree planners. Every change of the tree goes through
+ * the context, which records it in an append-only log; readers replay the
+ * log into their own nodes, so the tree itself is never shared.
+ */
+class TreePlanningContext : public PlanningContext
+{
+public:
+  void ReadLog(LogCursor &cursor, Log &log) const override;
+  void ReadTrace(LogCursor &cursor,
+                 SearchTraceWriter &trace) const override;
+
+  /**
+   * @brief Clear the tree and start an empty log for a new query.
+   *
+   */
+  void Clear();
+
+  /**
+   * @brief Change the tree and, if Logging is enabled, record the change.
+   * AddNode also counts the node and any growth of the tree arrays in stats.
+   *
+   */
+  template <typename Logging>
+  NodeIndex AddNode(const Node &node, const NodeIndex parent, const Cost &cost)
+  {
+    stats.nodes_generated++;
+    stats.allocations += tree.Size() == tree.Capacity();
+    const auto index{tree.AddNode(node, parent, cost)};
+    if constexpr (Logging::kEnabled)
+      {
+        AppendToLog(TreeLogEntry{node, index, parent, cost});
+      }
+    return index;
+  }
+  template <typename Logging>
+  void SetParent(const NodeIndex index, const NodeIndex parent,
+                 const Cost &cost)
+  {
+    tree.SetParent(index, parent);
+    tree.SetCost(index, cost);
+    if constexpr (Logging::kEnabled)
+      {
+        AppendToLog(TreeLogEntry{tree.GetNode(index), index, parent, cost});
+      }
+  }
+  template <typename Logging>
+  void SetCost(const NodeIndex index, const Cost &cost)
+  {
+    tree.SetCost(index, cost);
+    if constexpr (Logging::kEnabled)
+      {
+        AppendToLog(TreeLogEntry{tree.GetNode(index), index,
+                                 tree.GetParent(index), cost, true});
+      }
+  }
+  template <typename Logging> void SetGoal(const NodeIndex index)
+  {
+    goal_index = index;
+    if constexpr (Logging::kEnabled)
+      {
+        PublishGoal(index);
+      }
+  }
+
+  Tree tree{};
+  // Only changed by Clear and SetGoal.
+  NodeIndex goal_index{kInvalidNodeIndex};
+  KDTree kd_tree{};
+  std::shared_ptr<Map> map{std::make_shared<Map>(0, 0)};
+
+private:
+  struct TreeLog
+  {
+    AppendOnlyLog<TreeLogEntry> entries{};
+    // Published after the goal node is logged.
+    std::atomic<NodeIndex> goal_index{kInvalidNodeIndex};
+  };
+
+  void AppendToLog(const TreeLogEntry &entry);
+  void PublishGoal(const NodeIndex index);
+
+  // Only swapped with atomic_store so readers never wait for the query.
+  std::shared_ptr<TreeLog> log_{std::make_shared<TreeLog>()};
+}; // class TreePlanningContext
+
 } // namespace tree_base
 } // namespace planning
 
@@ -0,0 +1,197 @@
+/**
+ * @file component_labels.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "component_labels.h"
+#include "common_planning.h"
+
+#include <iostream>
+#include <queue>
+
+namespace planning
+{
+
+ComponentLabels::ComponentLabels(const int search_space)
+    : search_space_(search_space)
+{
+  if (search_space_ != 4 && search_space_ != 8)
+    {
+      std::cout << "Invalid search space." << std::endl;
+      search_space_ = 8;
+    }
+}
+
+void ComponentLabels::Build(const Map &map)
+{
+  height_ = static_cast<int>(map.GetHeight());
+  width_ = static_cast<int>(map.GetWidth());
+  labels_.assign(height_ * width_, -1);
+  parents_.clear();
+  ranks_.clear();
+
+  for (int x = 0; x < height_; x++)
+    {
+      for (int y = 0; y < width_; y++)
+        {
+          if (labels_[Index(x, y)] == -1 && IsPassable(x, y, map))
+            {
+              Flood(x, y, NewLabel(), map);
+            }
+        }
+    }
+}
+
+void ComponentLabels::Update(const Node &node, const Map &map)
+{
+  if (node.x_ < 0 || node.x_ >= height_ || node.y_ < 0 || node.y_ >= width_)
+    {
+      return;
+    }
+  auto &label{labels_[Index(node.x_, node.y_)]};
+  auto is_passable{IsPassable(node.x_, node.y_, map)};
+
+  std::vector<Node> neighbors;
+  for (int dx = -1; dx <= 1; dx++)
+    {
+      for (int dy = -1; dy <= 1; dy++)
+        {
+          if ((dx == 0 && dy == 0) ||
+              (search_space_ == 4 && dx != 0 && dy != 0))
+            {
+              continue;
+            }
+          if (IsPassable(node.x_ + dx, node.y_ + dy, map))
+            {
+              neighbors.emplace_back(node.x_ + dx, node.y_ + dy);
+            }
+        }
+    }
+
+  if (is_passable && label == -1)
+    {
+      // Freed cell joins every region around it.
+      label = NewLabel();
+      for (const auto &neighbor : neighbors)
+        {
+          Union(label, labels_[Index(neighbor.x_, neighbor.y_)]);
+        }
+    }
+  else if (!is_passable && label != -1)
+    {
+      // Occupied cell may split its region. Relabel from each neighbor that
+      // is not reached yet.
+      label = -1;
+      if (neighbors.size() < 2)
+        {
+          return;
+        }
+      auto first_label{NewLabel()};
+      Flood(neighbors.front().x_, neighbors.front().y_, first_label, map);
+      for (const auto &neighbor : neighbors)
+        {
+          auto neighbor_label{labels_[Index(neighbor.x_, neighbor.y_)]};
+          if (neighbor_label < first_label)
+            {
+              Flood(neighbor.x_, neighbor.y_, NewLabel(), map);
+            }
+        }
+    }
+}
+
+bool ComponentLabels::IsConnected(const Node &node1, const Node &node2) const
+{
+  if (!IsLabeled(node1) || !IsLabeled(node2))
+    {
+      return false;
+    }
+  return Find(labels_[Index(node1.x_, node1.y_)]) ==
+         Find(labels_[Index(node2.x_, node2.y_)]);
+}
+
+bool ComponentLabels::IsLabeled(const Node &node) const
+{
+  return node.x_ >= 0 && node.x_ < height_ && node.y_ >= 0 &&
+         node.y_ < width_ && labels_[Index(node.x_, node.y_)] != -1;
+}
+
+bool ComponentLabels::IsPassable(int x, int y, const Map &map) const
+{
+  return x >= 0 && x < height_ && y >= 0 && y < width_ &&
+         map.GetNodeState(Node(x, y)) != NodeState::kOccupied;
+}
+
+int ComponentLabels::NewLabel()
+{
+  parents_.emplace_back(static_cast<int>(parents_.size()));
+  ranks_.emplace_back(0);
+  return parents_.back();
+}
+
+int ComponentLabels::Find(int label) const
+{
+  while (parents_[label] != label)
+    {
+      label = parents_[label];
+    }
+  return label;
+}
+
+void ComponentLabels::Union(int label1, int label2)
+{
+  auto root1{Find(label1)};
+  auto root2{Find(label2)};
+  if (root1 == root2)
+    {
+      return;
+    }
+  if (ranks_[root1] < ranks_[root2])
+    {
+      std::swap(root1, root2);
+    }
+  parents_[root2] = root1;
+  if (ranks_[root1] == ranks_[root2])
+    {
+      ranks_[root1]++;
+    }
+}
+
+void ComponentLabels::Flood(int x, int y, int label, const Map &map)
+{
+  std::queue<Node> queue;
+  labels_[Index(x, y)] = label;
+  queue.emplace(x, y);
+
+  while (!queue.empty())
+    {
+      auto current{queue.front()};
+      queue.pop();
+      for (int dx = -1; dx <= 1; dx++)
+        {
+          for (int dy = -1; dy <= 1; dy++)
+            {
+              if (search_space_ == 4 && dx != 0 && dy != 0)
+                {
+                  continue;
+                }
+              int nx = current.x_ + dx;
+              int ny = current.y_ + dy;
+              if (!IsPassable(nx, ny, map) ||
+                  labels_[Index(nx, ny)] == label)
+                {
+                  continue;
+                }
+              labels_[Index(nx, ny)] = label;
+              queue.emplace(nx, ny);
+            }
+        }
+    }
+}
+
+} // namespace planning
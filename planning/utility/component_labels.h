@@ -0,0 +1,82 @@
+/**
+ * @file component_labels.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Connected-component labeling of free cells.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_COMPONENT_LABELS_H_
+#define PLANNING_INCLUDE_COMPONENT_LABELS_H_
+
+#include "data_types.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+class Map;
+
+/**
+ * @brief Labels every free cell with the connected region it belongs to, so
+ * reachability between two cells is answered without searching.
+ *
+ * Freeing a cell merges the regions around it with union-find. Occupying a
+ * cell relabels only the region it was part of, since it may split.
+ */
+class ComponentLabels
+{
+public:
+  /**
+   * @param search_space 4 or 8 connectivity. 8 is conservative for every
+   * planner, 4 also separates regions that only touch diagonally.
+   */
+  ComponentLabels(const int search_space);
+
+  /**
+   * @brief Label the whole map from scratch.
+   *
+   */
+  void Build(const Map &map);
+
+  /**
+   * @brief Update labels after the occupancy of a cell changed on the map.
+   *
+   */
+  void Update(const Node &node, const Map &map);
+
+  /**
+   * @brief Check if both nodes are free and in the same region.
+   *
+   */
+  bool IsConnected(const Node &node1, const Node &node2) const;
+
+  /**
+   * @brief Check if node is labeled, i.e. inbound and free.
+   *
+   */
+  bool IsLabeled(const Node &node) const;
+
+private:
+  std::size_t Index(int x, int y) const { return x * width_ + y; }
+  bool IsPassable(int x, int y, const Map &map) const;
+  int NewLabel();
+  int Find(int label) const;
+  void Union(int label1, int label2);
+  void Flood(int x, int y, int label, const Map &map);
+
+  int search_space_{8};
+  int height_{0};
+  int width_{0};
+  std::vector<int> labels_{};
+  std::vector<int> parents_{};
+  std::vector<int> ranks_{};
+}; // class ComponentLabels
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_COMPONENT_LABELS_H_ */
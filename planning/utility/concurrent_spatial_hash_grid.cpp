@@ -0,0 +1,130 @@
+/**
+ * @file concurrent_spatial_hash_grid.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "concurrent_spatial_hash_grid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace planning
+{
+
+ConcurrentSpatialHashGrid::ConcurrentSpatialHashGrid(const double cell_size,
+                                                     const std::size_t height,
+                                                     const std::size_t width)
+    : cell_size_(std::max(cell_size, 1.0)), stripes_(kStripeCount)
+{
+  rows_ = static_cast<int>(std::ceil(height / cell_size_)) + 1;
+  columns_ = static_cast<int>(std::ceil(width / cell_size_)) + 1;
+  buckets_.resize(rows_ * columns_);
+}
+
+void ConcurrentSpatialHashGrid::Insert(const Node &node, const std::size_t id)
+{
+  const auto bucket{Row(node.x_) * columns_ + Column(node.y_)};
+  {
+    std::lock_guard<std::mutex> lock(Stripe(bucket));
+    buckets_[bucket].push_back({node, id});
+  }
+  size_++;
+}
+
+void ConcurrentSpatialHashGrid::Radius(const Node &node, const double radius,
+                                       std::vector<Entry> &entries) const
+{
+  entries.clear();
+  const auto squared_radius{radius * radius};
+  for (auto row = Row(node.x_ - radius); row <= Row(node.x_ + radius); row++)
+    {
+      for (auto column = Column(node.y_ - radius);
+           column <= Column(node.y_ + radius); column++)
+        {
+          const auto bucket{row * columns_ + column};
+          std::lock_guard<std::mutex> lock(Stripe(bucket));
+          for (const auto &entry : buckets_[bucket])
+            {
+              double dx = entry.node.x_ - node.x_;
+              double dy = entry.node.y_ - node.y_;
+              if (dx * dx + dy * dy < squared_radius)
+                {
+                  entries.emplace_back(entry);
+                }
+            }
+        }
+    }
+}
+
+bool ConcurrentSpatialHashGrid::Nearest(const Node &node, Entry &nearest) const
+{
+  const auto center_row{Row(node.x_)};
+  const auto center_column{Column(node.y_)};
+  auto best_squared_distance{std::numeric_limits<double>::max()};
+  auto is_found{false};
+  for (auto ring = 0; ring < std::max(rows_, columns_); ring++)
+    {
+      // Points in ring r are at least (r - 1) cells away.
+      const auto ring_distance{(ring - 1) * cell_size_};
+      if (is_found && ring_distance > 0 &&
+          ring_distance * ring_distance > best_squared_distance)
+        {
+          break;
+        }
+      for (auto row = center_row - ring; row <= center_row + ring; row++)
+        {
+          if (row < 0 || row >= rows_)
+            {
+              continue;
+            }
+          // Only the border of the ring, inner buckets are already searched.
+          const auto step{
+              (row == center_row - ring || row == center_row + ring)
+                  ? 1
+                  : std::max(2 * ring, 1)};
+          for (auto column = center_column - ring;
+               column <= center_column + ring; column += step)
+            {
+              if (column < 0 || column >= columns_)
+                {
+                  continue;
+                }
+              const auto bucket{row * columns_ + column};
+              std::lock_guard<std::mutex> lock(Stripe(bucket));
+              for (const auto &entry : buckets_[bucket])
+                {
+                  double dx = entry.node.x_ - node.x_;
+                  double dy = entry.node.y_ - node.y_;
+                  if (dx * dx + dy * dy < best_squared_distance)
+                    {
+                      best_squared_distance = dx * dx + dy * dy;
+                      nearest = entry;
+                      is_found = true;
+                    }
+                }
+            }
+        }
+    }
+  return is_found;
+}
+
+int ConcurrentSpatialHashGrid::Row(const double x) const
+{
+  return std::clamp(static_cast<int>(std::floor(x / cell_size_)), 0,
+                    rows_ - 1);
+}
+
+int ConcurrentSpatialHashGrid::Column(const double y) const
+{
+  return std::clamp(static_cast<int>(std::floor(y / cell_size_)), 0,
+                    columns_ - 1);
+}
+
+} // namespace planning
@@ -0,0 +1,83 @@
+/**
+ * @file concurrent_spatial_hash_grid.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Thread safe uniform bucket grid for radius and nearest queries.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_CONCURRENT_SPATIAL_HASH_GRID_H_
+#define PLANNING_INCLUDE_CONCURRENT_SPATIAL_HASH_GRID_H_
+
+#include "data_types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace planning
+{
+
+/**
+ * @brief Same bucketing as SpatialHashGrid, but buckets are guarded by a
+ * fixed set of striped mutexes so threads can insert and query at the same
+ * time. Entries keep the point itself, so queries need no other storage.
+ */
+class ConcurrentSpatialHashGrid
+{
+public:
+  struct Entry
+  {
+    Node node{};
+    std::size_t id{0};
+  };
+
+  ConcurrentSpatialHashGrid(const double cell_size, const std::size_t height,
+                            const std::size_t width);
+
+  void Insert(const Node &node, const std::size_t id);
+
+  /**
+   * @brief Get the entries closer than radius to node.
+   *
+   * @param node
+   * @param radius
+   * @param entries Cleared, then filled with the result.
+   */
+  void Radius(const Node &node, const double radius,
+              std::vector<Entry> &entries) const;
+
+  /**
+   * @brief Get the nearest entry by searching rings of buckets around node.
+   *
+   * @return true if the grid is not empty.
+   */
+  bool Nearest(const Node &node, Entry &nearest) const;
+
+  std::size_t Size() const { return size_; }
+
+private:
+  static constexpr std::size_t kStripeCount{64};
+
+  int Row(const double x) const;
+  int Column(const double y) const;
+  std::mutex &Stripe(const int bucket) const
+  {
+    return stripes_[bucket % kStripeCount];
+  }
+
+  double cell_size_{1.0};
+  int rows_{0};
+  int columns_{0};
+  std::atomic<std::size_t> size_{0};
+  std::vector<std::vector<Entry>> buckets_{};
+  mutable std::vector<std::mutex> stripes_;
+}; // class ConcurrentSpatialHashGrid
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_CONCURRENT_SPATIAL_HASH_GRID_H_ */
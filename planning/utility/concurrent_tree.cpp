@@ -0,0 +1,234 @@
+/**
+ * @file concurrent_tree.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "concurrent_tree.h"
+
+#include "common_planning.h"
+
+#include <algorithm>
+
+namespace planning
+{
+
+ConcurrentTree::ConcurrentTree(const std::size_t capacity)
+    : capacity_(capacity), x_(capacity), y_(capacity),
+      parents_(new std::atomic<NodeIndex>[capacity]), costs_(capacity),
+      is_added_(capacity, false), children_(capacity), stripes_(kStripeCount)
+{
+  for (auto i = 0u; i < capacity; i++)
+    {
+      parents_[i].store(kInvalidNodeIndex);
+    }
+}
+
+NodeIndex ConcurrentTree::AddNode(const Node &node, const NodeIndex parent)
+{
+  const auto index{size_.fetch_add(1)};
+  if (index >= capacity_)
+    {
+      return kInvalidNodeIndex;
+    }
+
+  Cost cost;
+  if (parent != kInvalidNodeIndex)
+    {
+      const auto parent_cost{GetCost(parent)};
+      cost = Cost(parent_cost.g + 1,
+                  parent_cost.h + EuclideanDistance(node, GetNode(parent)));
+    }
+  {
+    std::lock_guard<std::mutex> lock(Stripe(index));
+    x_[index] = node.x_;
+    y_[index] = node.y_;
+    costs_[index] = cost;
+    is_added_[index] = true;
+    parents_[index].store(parent);
+  }
+  if (parent != kInvalidNodeIndex)
+    {
+      std::lock_guard<std::mutex> lock(Stripe(parent));
+      children_[parent].push_back(index);
+    }
+  return index;
+}
+
+Cost ConcurrentTree::GetCost(const NodeIndex index) const
+{
+  std::lock_guard<std::mutex> lock(Stripe(index));
+  return costs_[index];
+}
+
+bool ConcurrentTree::Rewire(const NodeIndex index, const NodeIndex parent)
+{
+  const auto parent_cost{GetCost(parent)};
+  const auto cost{Cost(parent_cost.g + 1,
+                       parent_cost.h +
+                           EuclideanDistance(GetNode(index), GetNode(parent)))};
+  {
+    std::lock_guard<std::mutex> lock(Stripe(index));
+    if (cost.f >= costs_[index].f)
+      {
+        return false;
+      }
+    costs_[index] = cost;
+    parents_[index].store(parent);
+  }
+  std::lock_guard<std::mutex> lock(Stripe(parent));
+  children_[parent].push_back(index);
+  return true;
+}
+
+void ConcurrentTree::UpdateCosts(const NodeIndex index,
+                                 std::vector<NodeIndex> &update_stack)
+{
+  update_stack.clear();
+  update_stack.push_back(index);
+  while (!update_stack.empty())
+    {
+      const auto parent{update_stack.back()};
+      update_stack.pop_back();
+
+      // Cost and children are read together, so every cost written below is
+      // one the parent had.
+      const auto first{update_stack.size()};
+      Cost parent_cost;
+      {
+        std::lock_guard<std::mutex> lock(Stripe(parent));
+        parent_cost = costs_[parent];
+        auto &children{children_[parent]};
+        children.erase(std::remove_if(children.begin(), children.end(),
+                                      [this, parent](const NodeIndex child) {
+                                        return parents_[child].load() !=
+                                               parent;
+                                      }),
+                       children.end());
+        update_stack.insert(update_stack.end(), children.begin(),
+                            children.end());
+      }
+
+      // Only children whose cost dropped are expanded further.
+      const auto parent_node{GetNode(parent)};
+      auto last{first};
+      for (auto i = first; i < update_stack.size(); i++)
+        {
+          const auto child{update_stack[i]};
+          const auto cost{
+              Cost(parent_cost.g + 1,
+                   parent_cost.h +
+                       EuclideanDistance(GetNode(child), parent_node))};
+          std::lock_guard<std::mutex> lock(Stripe(child));
+          if (parents_[child].load() == parent && cost.f < costs_[child].f)
+            {
+              costs_[child] = cost;
+              update_stack[last++] = child;
+            }
+        }
+      update_stack.resize(last);
+    }
+}
+
+std::size_t ConcurrentTree::Size() const
+{
+  return std::min(size_.load(), capacity_);
+}
+
+Path ConcurrentTree::ReconstructPath(const NodeIndex index) const
+{
+  Path path;
+  if (index == kInvalidNodeIndex)
+    {
+      return path;
+    }
+  for (auto current = index; current != kInvalidNodeIndex;
+       current = GetParent(current))
+    {
+      path.emplace_back(GetNode(current));
+    }
+  return Path(path.rbegin(), path.rend());
+}
+
+std::vector<std::shared_ptr<NodeParent>> ConcurrentTree::ToNodeParents() const
+{
+  // Nodes are published out of order, copy the added prefix.
+  std::vector<Node> nodes;
+  std::vector<NodeIndex> parents;
+  std::vector<Cost> costs;
+  for (auto i = 0u; i < Size(); i++)
+    {
+      std::lock_guard<std::mutex> lock(Stripe(i));
+      if (!is_added_[i])
+        {
+          break;
+        }
+      nodes.emplace_back(GetNode(i));
+      parents.emplace_back(parents_[i].load());
+      costs.emplace_back(costs_[i]);
+    }
+  const auto size{nodes.size()};
+
+  // Walk each parent chain once, cutting it at a cycle or at a parent out of
+  // the copy, then recompute the costs top-down.
+  enum class Visit : std::uint8_t
+  {
+    kNone,
+    kOpen,
+    kDone
+  };
+  std::vector<Visit> visits(size, Visit::kNone);
+  std::vector<NodeIndex> chain;
+  for (auto i = 0u; i < size; i++)
+    {
+      chain.clear();
+      auto current{static_cast<NodeIndex>(i)};
+      while (current != kInvalidNodeIndex && visits[current] == Visit::kNone)
+        {
+          visits[current] = Visit::kOpen;
+          chain.push_back(current);
+          current = parents[current];
+          if (current != kInvalidNodeIndex &&
+              (current >= size || visits[current] == Visit::kOpen))
+            {
+              parents[chain.back()] = kInvalidNodeIndex;
+              current = kInvalidNodeIndex;
+            }
+        }
+      for (auto it = chain.rbegin(); it != chain.rend(); it++)
+        {
+          const auto parent{parents[*it]};
+          if (parent != kInvalidNodeIndex)
+            {
+              costs[*it] =
+                  Cost(costs[parent].g + 1,
+                       costs[parent].h +
+                           EuclideanDistance(nodes[*it], nodes[parent]));
+            }
+          visits[*it] = Visit::kDone;
+        }
+    }
+
+  std::vector<std::shared_ptr<NodeParent>> node_parents;
+  node_parents.reserve(size);
+  for (auto i = 0u; i < size; i++)
+    {
+      node_parents.emplace_back(
+          std::make_shared<NodeParent>(nodes[i], nullptr, costs[i]));
+    }
+  for (auto i = 0u; i < size; i++)
+    {
+      if (parents[i] != kInvalidNodeIndex)
+        {
+          node_parents[i]->parent = node_parents[parents[i]];
+        }
+    }
+  return node_parents;
+}
+
+} // namespace planning
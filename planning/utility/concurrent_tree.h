@@ -0,0 +1,126 @@
+/**
+ * @file concurrent_tree.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Tree that threads grow and rewire at the same time.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_CONCURRENT_TREE_H_
+#define PLANNING_INCLUDE_CONCURRENT_TREE_H_
+
+#include "data_types.h"
+#include "node_parent.h"
+#include "tree.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace planning
+{
+
+/**
+ * @brief Fixed capacity tree whose nodes are guarded by striped mutexes, like
+ * the buckets of ConcurrentSpatialHashGrid. No call holds two stripes, so
+ * there is no lock order to keep.
+ *
+ * Costs only decrease, and a cost is always the cost its parent had at some
+ * earlier moment plus the edge. A node is therefore always more expensive
+ * than its parent, and a rewire that lowers a cost can never close a cycle.
+ * While threads run, costs are upper bounds: UpdateCosts lowers descendants
+ * after a rewire one node at a time.
+ */
+class ConcurrentTree
+{
+public:
+  explicit ConcurrentTree(const std::size_t capacity);
+
+  /**
+   * @brief Add node below parent, kInvalidNodeIndex for a root. Cost goes
+   * through the current cost of parent.
+   *
+   * @return NodeIndex Index of the new node, kInvalidNodeIndex if the tree
+   * is full.
+   */
+  NodeIndex AddNode(const Node &node, const NodeIndex parent);
+
+  /**
+   * @brief Position of a node whose index came from AddNode, a child list or
+   * another synchronized structure.
+   *
+   */
+  Node GetNode(const NodeIndex index) const
+  {
+    return Node(x_[index], y_[index]);
+  }
+  Cost GetCost(const NodeIndex index) const;
+  NodeIndex GetParent(const NodeIndex index) const
+  {
+    return parents_[index].load();
+  }
+
+  /**
+   * @brief Move index below parent if the cost through parent is lower.
+   *
+   * @return true if index is rewired.
+   */
+  bool Rewire(const NodeIndex index, const NodeIndex parent);
+
+  /**
+   * @brief Lower the costs of the descendants of index to match it. Stops at
+   * nodes whose cost does not drop.
+   *
+   * @param update_stack Scratch buffer, reused across calls.
+   */
+  void UpdateCosts(const NodeIndex index,
+                   std::vector<NodeIndex> &update_stack);
+
+  std::size_t Size() const;
+
+  /**
+   * @brief Backtrace path from index to its root. Only call when no thread
+   * changes the tree.
+   *
+   */
+  Path ReconstructPath(const NodeIndex index) const;
+
+  /**
+   * @brief Copy of the tree as NodeParent graph, element i is node i, with
+   * costs recomputed from the roots. Safe while threads change the tree: the
+   * copy stops at the first node still being added, and parents read at
+   * different moments can form a cycle, which is cut.
+   *
+   */
+  std::vector<std::shared_ptr<NodeParent>> ToNodeParents() const;
+
+private:
+  static constexpr std::size_t kStripeCount{256};
+
+  std::mutex &Stripe(const NodeIndex index) const
+  {
+    return stripes_[index % kStripeCount];
+  }
+
+  std::size_t capacity_{0};
+  std::atomic<std::size_t> size_{0};
+  std::vector<int> x_{};
+  std::vector<int> y_{};
+  std::unique_ptr<std::atomic<NodeIndex>[]> parents_{};
+  // Guarded by the stripe of the node.
+  std::vector<Cost> costs_{};
+  std::vector<std::uint8_t> is_added_{};
+  // Children may keep nodes that were rewired away, readers check parents.
+  std::vector<std::vector<NodeIndex>> children_{};
+  mutable std::vector<std::mutex> stripes_;
+}; // class ConcurrentTree
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_CONCURRENT_TREE_H_ */
@@ -0,0 +1,97 @@
+/**
+ * @file i_planning.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "i_planning.h"
+#include "work_stealing_pool.h"
+
+namespace planning
+{
+
+std::vector<QueryResult> IPlanning::FindPaths(const std::vector<Query> &queries,
+                                              const std::shared_ptr<Map> map,
+                                              const unsigned int)
+{
+  std::vector<QueryResult> results(queries.size());
+  for (auto i = 0u; i < queries.size(); i++)
+    {
+      auto start_time{std::chrono::steady_clock::now()};
+      results[i].path = FindPath(queries[i].first, queries[i].second, map);
+      results[i].stats.duration = std::chrono::steady_clock::now() - start_time;
+      results[i].stats.planning = GetStats();
+    }
+  return results;
+}
+
+std::future<Path>
+IPlanning::FindPathAsync(const Node &start_node, const Node &goal_node,
+                         const std::shared_ptr<Map> map,
+                         std::shared_ptr<const CancellationToken> token,
+                         const std::chrono::steady_clock::time_point deadline)
+{
+  return std::async(
+      std::launch::async,
+      [this, start_node, goal_node, map, token, deadline]() {
+        // Later FindPath calls run without the stop condition again.
+        stop_condition_ = StopCondition(token, deadline);
+        auto path{FindPath(start_node, goal_node, map)};
+        stop_condition_ = StopCondition{};
+        return path;
+      });
+}
+
+std::future<Path> PlanningWithContext::FindPathAsync(
+    const Node &start_node, const Node &goal_node,
+    const std::shared_ptr<Map> map,
+    std::shared_ptr<const CancellationToken> token,
+    const std::chrono::steady_clock::time_point deadline)
+{
+  std::shared_ptr<PlanningContext> context{CreateContext()};
+  context->SetStopConditions(std::move(token), deadline);
+  {
+    std::lock_guard<std::mutex> lock(log_context_mutex_);
+    log_context_ = context;
+  }
+  return std::async(std::launch::async,
+                    [this, start_node, goal_node, map, context]() {
+                      return FindPath(start_node, goal_node, map, *context);
+                    });
+}
+
+std::vector<QueryResult>
+PlanningWithContext::FindPaths(const std::vector<Query> &queries,
+                               const std::shared_ptr<Map> map,
+                               const unsigned int thread_count)
+{
+  std::vector<QueryResult> results(queries.size());
+  WorkStealingPool pool(thread_count);
+  std::vector<std::unique_ptr<PlanningContext>> contexts;
+  for (auto i = 0u; i < pool.GetThreadCount(); i++)
+    {
+      contexts.emplace_back(CreateContext());
+      contexts.back()->SetLogging(false);
+    }
+
+  pool.Run(queries.size(),
+           [&](const std::size_t index, const unsigned int worker) {
+             auto start_time{std::chrono::steady_clock::now()};
+             auto &result{results[index]};
+             result.path = FindPath(queries[index].first,
+                                    queries[index].second, map,
+                                    *contexts[worker]);
+             result.stats.duration =
+                 std::chrono::steady_clock::now() - start_time;
+             result.stats.worker = worker;
+             result.stats.planning = contexts[worker]->stats;
+           });
+  return results;
+}
+
+} // namespace planning
@@ -12,16 +12,45 @@
 #ifndef PLANNING_INCLUDE_I_PLANNING_H_
 #define PLANNING_INCLUDE_I_PLANNING_H_
 
+#include "cancellation_token.h"
 #include "data_types.h"
 #include "node_parent.h"
+#include "planning_stats.h"
 
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 namespace planning
 {
 class Map;
+class SearchTraceWriter;
+
+using Query = std::pair<Node, Node>;
+
+/**
+ * @brief Statistics of one query of a batch.
+ *
+ */
+struct QueryStats
+{
+  std::chrono::nanoseconds duration{};
+  // Worker thread the query ran on.
+  unsigned int worker{0};
+  PlanningStats planning{};
+};
+
+struct QueryResult
+{
+  Path path{};
+  QueryStats stats{};
+};
 
 class IPlanning
 {
@@ -36,18 +65,79 @@ public:
   virtual Path FindPath(const Node &start_node, const Node &goal_node,
                         const std::shared_ptr<Map> map) = 0;
 
+  /**
+   * @brief Find path for every (start, goal) query on one map. Results are in
+   * query order. Planners with per-instance search state run the queries one
+   * by one and ignore thread count.
+   *
+   * @param thread_count Zero uses every hardware thread.
+   */
+  virtual std::vector<QueryResult>
+  FindPaths(const std::vector<Query> &queries, const std::shared_ptr<Map> map,
+            const unsigned int thread_count = 0);
+
+  /**
+   * @brief Counters and phase times of the last FindPath call. Planners that
+   * do not count return zeros. Read once the query has finished.
+   *
+   */
+  virtual PlanningStats GetStats() const { return PlanningStats{}; }
+
+  /**
+   * @brief Find path on a new thread. The search is abandoned once token is
+   * cancelled or deadline has passed, each planner documents what it returns
+   * then. Planner must outlive the future. Planners without contexts run one
+   * query at a time, so do not call FindPath until the future is ready.
+   *
+   */
+  virtual std::future<Path> FindPathAsync(
+      const Node &start_node, const Node &goal_node,
+      const std::shared_ptr<Map> map,
+      std::shared_ptr<const CancellationToken> token = nullptr,
+      const std::chrono::steady_clock::time_point deadline =
+          std::chrono::steady_clock::time_point::max());
+
   virtual ~IPlanning() {}
+
+protected:
+  // Stop condition of the query run by FindPathAsync, checked once per
+  // iteration by planners without contexts.
+  StopCondition stop_condition_{};
 }; // class IPathFinding
 
 using Log = std::pair<std::vector<std::shared_ptr<NodeParent>>,
                       std::shared_ptr<NodeParent>>;
 
+/**
+ * @brief Position of a reader in the log of a query. Default constructed, it
+ * reads the log from the beginning.
+ *
+ */
+struct LogCursor
+{
+  // Log of the query read so far, a new query restarts the cursor.
+  std::shared_ptr<const void> source{};
+  std::size_t index{0};
+};
+
 class ILogging
 {
 public:
   virtual Log GetLog() = 0;
   virtual void ClearLog() = 0;
 
+  /**
+   * @brief Bring log up to date from cursor: only entries logged since the
+   * last call are added. log must only be changed by ReadLog. Planners without
+   * an incremental log copy the whole log.
+   *
+   */
+  virtual void ReadLog(LogCursor &cursor, Log &log)
+  {
+    log = GetLog();
+    cursor = LogCursor{};
+  }
+
   virtual ~ILogging() {}
 };
 
@@ -55,6 +145,295 @@ class IPlanningWithLogging : public IPlanning, public ILogging
 {
 };
 
+/**
+ * @brief Logging policies of the planner templates. With NoLogging every log
+ * call is compiled out and the log of a query stays empty.
+ *
+ */
+struct ExpansionLogging
+{
+  static constexpr bool kEnabled{true};
+};
+
+struct NoLogging
+{
+  static constexpr bool kEnabled{false};
+};
+
+/**
+ * @brief Holds the log mutex of a planner without contexts for its scope.
+ * With NoLogging nothing is locked.
+ *
+ */
+template <typename Logging> class LogLock
+{
+public:
+  explicit LogLock(std::mutex &mutex) : mutex_(mutex)
+  {
+    if constexpr (Logging::kEnabled)
+      {
+        mutex_.lock();
+      }
+  }
+  ~LogLock()
+  {
+    if constexpr (Logging::kEnabled)
+      {
+        mutex_.unlock();
+      }
+  }
+  LogLock(const LogLock &) = delete;
+  LogLock &operator=(const LogLock &) = delete;
+
+private:
+  std::mutex &mutex_;
+}; // class LogLock
+
+enum class PlanningStatus
+{
+  kRunning,
+  kSucceeded,
+  kFailed
+};
+
+/**
+ * @brief Search state of one query, i.e. scratch buffers and the log. A
+ * context runs one query at a time and keeps its buffers for the next one.
+ */
+class PlanningContext
+{
+public:
+  /**
+   * @brief Bring log up to date from cursor, see ILogging::ReadLog. Lock free
+   * and safe to call while the query runs.
+   *
+   */
+  virtual void ReadLog(LogCursor &cursor, Log &log) const = 0;
+
+  /**
+   * @brief Like ReadLog, but encode the new entries to trace. Tree rewires are
+   * kept as rewire records. Use one cursor per trace.
+   *
+   */
+  virtual void ReadTrace(LogCursor &cursor, SearchTraceWriter &trace) const = 0;
+
+  /**
+   * @brief Copy of the whole log of the query run with this context.
+   *
+   */
+  Log GetLog() const
+  {
+    LogCursor cursor;
+    Log log;
+    ReadLog(cursor, log);
+    return log;
+  }
+
+  /**
+   * @brief Queries record their log only while logging is on. Turning it off
+   * removes every log allocation from the search.
+   *
+   */
+  void SetLogging(const bool logging) { logging_ = logging; }
+  bool IsLogging() const { return logging_; }
+
+  /**
+   * @brief Queries run with this context stop once token is cancelled or
+   * deadline has passed. Null token and time_point::max disable each rule.
+   *
+   */
+  void SetStopConditions(std::shared_ptr<const CancellationToken> token,
+                         const std::chrono::steady_clock::time_point deadline)
+  {
+    stop_condition_ = StopCondition(std::move(token), deadline);
+  }
+
+  /**
+   * @brief Checked once per planner iteration, see StopCondition.
+   *
+   */
+  bool ShouldStop() { return stop_condition_.ShouldStop(); }
+
+  /**
+   * @brief Status of the query begun in this context, and its path once it
+   * has succeeded.
+   *
+   */
+  PlanningStatus GetStatus() const { return status_; }
+  const Path &GetPath() const { return path_; }
+
+  /**
+   * @brief Called by planners when a query begins and ends. An empty path is
+   * a failure.
+   *
+   */
+  void SetRunning()
+  {
+    status_ = PlanningStatus::kRunning;
+    path_.clear();
+    stats = PlanningStats{};
+  }
+  PlanningStatus SetResult(Path path)
+  {
+    path_ = std::move(path);
+    status_ =
+        path_.empty() ? PlanningStatus::kFailed : PlanningStatus::kSucceeded;
+    return status_;
+  }
+
+  virtual ~PlanningContext() {}
+
+  // Written by the planner running the query, cleared when it begins.
+  PlanningStats stats{};
+
+protected:
+  bool logging_{true};
+
+private:
+  StopCondition stop_condition_{};
+  PlanningStatus status_{PlanningStatus::kFailed};
+  Path path_{};
+}; // class PlanningContext
+
+/**
+ * @brief Planner whose configuration is only read by FindPath. Search state
+ * lives in a PlanningContext, so one planner serves concurrent queries on a
+ * shared read-only map as long as each brings its own context.
+ */
+class PlanningWithContext : public IPlanningWithLogging
+{
+public:
+  virtual std::unique_ptr<PlanningContext> CreateContext() const = 0;
+
+  /**
+   * @brief Start a query in context without expanding anything. Context must
+   * come from CreateContext of this planner, and map must outlive the query.
+   *
+   */
+  virtual void Begin(const Node &start_node, const Node &goal_node,
+                     const std::shared_ptr<Map> map,
+                     PlanningContext &context) const = 0;
+
+  /**
+   * @brief Run at most iterations iterations (node expansions or tree
+   * samples) of the query begun in context, then return. Lets a single
+   * thread interleave a query with other work without locks; the path is in
+   * context once the status is not running.
+   *
+   */
+  virtual PlanningStatus Step(const std::size_t iterations,
+                              PlanningContext &context) const = 0;
+
+  /**
+   * @brief Find path using context, i.e. Begin and Step until it finishes.
+   * Thread safe for distinct contexts.
+   *
+   */
+  Path FindPath(const Node &start_node, const Node &goal_node,
+                const std::shared_ptr<Map> map,
+                PlanningContext &context) const
+  {
+    Begin(start_node, goal_node, map, context);
+    while (Step(std::numeric_limits<std::size_t>::max(), context) ==
+           PlanningStatus::kRunning)
+      {
+      }
+    return context.GetPath();
+  }
+
+  /**
+   * @brief Find path in a new context. GetLog follows the context of the
+   * latest call.
+   *
+   */
+  Path FindPath(const Node &start_node, const Node &goal_node,
+                const std::shared_ptr<Map> map) override
+  {
+    std::shared_ptr<PlanningContext> context{CreateContext()};
+    {
+      std::lock_guard<std::mutex> lock(log_context_mutex_);
+      log_context_ = context;
+    }
+    return FindPath(start_node, goal_node, map, *context);
+  }
+
+  /**
+   * @brief Find path on a new thread in a new context, see
+   * IPlanning::FindPathAsync. Grid planners and RRT return an empty path
+   * when stopped, RRT* the best path found so far. GetLog follows the context
+   * of this query, and queries may run concurrently.
+   *
+   */
+  std::future<Path> FindPathAsync(
+      const Node &start_node, const Node &goal_node,
+      const std::shared_ptr<Map> map,
+      std::shared_ptr<const CancellationToken> token = nullptr,
+      const std::chrono::steady_clock::time_point deadline =
+          std::chrono::steady_clock::time_point::max()) override;
+
+  /**
+   * @brief Queries run on a work-stealing pool, each worker reuses one
+   * context with logging off. Does not change GetLog.
+   *
+   */
+  std::vector<QueryResult> FindPaths(const std::vector<Query> &queries,
+                                     const std::shared_ptr<Map> map,
+                                     const unsigned int thread_count = 0)
+      override;
+
+  Log GetLog() override
+  {
+    auto context{GetLogContext()};
+    return context != nullptr ? context->GetLog() : Log{};
+  }
+  void ReadLog(LogCursor &cursor, Log &log) override
+  {
+    auto context{GetLogContext()};
+    if (context != nullptr)
+      {
+        context->ReadLog(cursor, log);
+      }
+    else
+      {
+        cursor = LogCursor{};
+        log = Log{};
+      }
+  }
+  /**
+   * @brief Stats of the context GetLog follows.
+   *
+   */
+  PlanningStats GetStats() const override
+  {
+    auto context{GetLogContext()};
+    return context != nullptr ? context->stats : PlanningStats{};
+  }
+  void ReadTrace(LogCursor &cursor, SearchTraceWriter &trace) const
+  {
+    auto context{GetLogContext()};
+    if (context != nullptr)
+      {
+        context->ReadTrace(cursor, trace);
+      }
+  }
+  void ClearLog() override
+  {
+    std::lock_guard<std::mutex> lock(log_context_mutex_);
+    log_context_ = nullptr;
+  }
+
+protected:
+  std::shared_ptr<PlanningContext> GetLogContext() const
+  {
+    std::lock_guard<std::mutex> lock(log_context_mutex_);
+    return log_context_;
+  }
+
+private:
+  std::shared_ptr<PlanningContext> log_context_{};
+  mutable std::mutex log_context_mutex_{};
+}; // class PlanningWithContext
+
 } // namespace planning
 
 #endif /* PLANNING_INCLUDE_I_PLANNING_H_ */
@@ -0,0 +1,180 @@
+/**
+ * @file kd_tree.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "kd_tree.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+namespace planning
+{
+
+namespace
+{
+int64_t SquaredDistance(const Node &node1, const Node &node2)
+{
+  int64_t dx = node1.x_ - node2.x_;
+  int64_t dy = node1.y_ - node2.y_;
+  return dx * dx + dy * dy;
+}
+} // namespace
+
+void KDTree::Insert(const Node &node, const std::size_t id)
+{
+  Point point;
+  point.node = node;
+  point.id = id;
+  auto new_index{static_cast<int32_t>(points_.size())};
+
+  if (points_.empty())
+    {
+      points_.emplace_back(point);
+      return;
+    }
+
+  int32_t index{0};
+  while (true)
+    {
+      auto &current{points_[index]};
+      auto go_left{current.split_x ? node.x_ < current.node.x_
+                                   : node.y_ < current.node.y_};
+      auto &child{go_left ? current.left : current.right};
+      if (child == -1)
+        {
+          child = new_index;
+          point.split_x = !current.split_x;
+          break;
+        }
+      index = child;
+    }
+  points_.emplace_back(point);
+}
+
+std::size_t KDTree::Nearest(const Node &node) const
+{
+  int32_t best{0};
+  auto best_distance{std::numeric_limits<int64_t>::max()};
+  Nearest(0, node, best, best_distance);
+  return points_[best].id;
+}
+
+void KDTree::Nearest(const int32_t index, const Node &node, int32_t &best,
+                     int64_t &best_distance) const
+{
+  if (index == -1)
+    {
+      return;
+    }
+  const auto &current{points_[index]};
+  auto distance{SquaredDistance(current.node, node)};
+  if (distance < best_distance)
+    {
+      best_distance = distance;
+      best = index;
+    }
+
+  int64_t delta = current.split_x ? node.x_ - current.node.x_
+                                  : node.y_ - current.node.y_;
+  auto near_child{delta < 0 ? current.left : current.right};
+  auto far_child{delta < 0 ? current.right : current.left};
+  Nearest(near_child, node, best, best_distance);
+  if (delta * delta < best_distance)
+    {
+      Nearest(far_child, node, best, best_distance);
+    }
+}
+
+void KDTree::Radius(const Node &node, const double radius,
+                    std::vector<std::size_t> &ids) const
+{
+  ids.clear();
+  if (points_.empty())
+    {
+      return;
+    }
+
+  std::vector<int32_t> stack{0};
+  while (!stack.empty())
+    {
+      const auto &current{points_[stack.back()]};
+      stack.pop_back();
+      if (static_cast<double>(SquaredDistance(current.node, node)) <
+          radius * radius)
+        {
+          ids.emplace_back(current.id);
+        }
+
+      double delta = current.split_x ? node.x_ - current.node.x_
+                                     : node.y_ - current.node.y_;
+      if (current.left != -1 && delta < radius)
+        {
+          stack.emplace_back(current.left);
+        }
+      if (current.right != -1 && delta > -radius)
+        {
+          stack.emplace_back(current.right);
+        }
+    }
+}
+
+void KDTree::KNearest(const Node &node, const std::size_t k,
+                      std::vector<std::size_t> &ids) const
+{
+  ids.clear();
+  if (points_.empty() || k == 0)
+    {
+      return;
+    }
+
+  // Max heap of the best k by distance, its top bounds the search.
+  std::vector<std::pair<int64_t, std::size_t>> best;
+  best.reserve(k + 1);
+  std::vector<int32_t> stack{0};
+  while (!stack.empty())
+    {
+      const auto &current{points_[stack.back()]};
+      stack.pop_back();
+      auto distance{SquaredDistance(current.node, node)};
+      if (best.size() < k || distance < best.front().first)
+        {
+          best.emplace_back(distance, current.id);
+          std::push_heap(best.begin(), best.end());
+          if (best.size() > k)
+            {
+              std::pop_heap(best.begin(), best.end());
+              best.pop_back();
+            }
+        }
+
+      int64_t delta = current.split_x ? node.x_ - current.node.x_
+                                      : node.y_ - current.node.y_;
+      auto near_child{delta < 0 ? current.left : current.right};
+      auto far_child{delta < 0 ? current.right : current.left};
+      if (far_child != -1 &&
+          (best.size() < k || delta * delta < best.front().first))
+        {
+          stack.emplace_back(far_child);
+        }
+      if (near_child != -1)
+        {
+          stack.emplace_back(near_child);
+        }
+    }
+
+  std::sort_heap(best.begin(), best.end());
+  for (const auto &point : best)
+    {
+      ids.emplace_back(point.second);
+    }
+}
+
+} // namespace planning
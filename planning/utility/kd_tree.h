@@ -0,0 +1,82 @@
+/**
+ * @file kd_tree.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Incremental 2D KD-tree for nearest neighbor queries.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_KD_TREE_H_
+#define PLANNING_INCLUDE_KD_TREE_H_
+
+#include "data_types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace planning
+{
+
+/**
+ * @brief 2D KD-tree that grows one point at a time. Every point carries an id,
+ * e.g. its index in the node storage of a planner. Points are not rebalanced;
+ * randomly sampled points keep the tree depth logarithmic.
+ */
+class KDTree
+{
+public:
+  void Insert(const Node &node, const std::size_t id);
+
+  /**
+   * @brief Get id of the point nearest to node. Tree must not be empty.
+   *
+   */
+  std::size_t Nearest(const Node &node) const;
+
+  /**
+   * @brief Get ids of the points closer than radius to node.
+   *
+   * @param node
+   * @param radius
+   * @param ids Cleared, then filled with the result.
+   */
+  void Radius(const Node &node, const double radius,
+              std::vector<std::size_t> &ids) const;
+
+  /**
+   * @brief Get ids of the k points nearest to node, nearest first.
+   *
+   * @param node
+   * @param k
+   * @param ids Cleared, then filled with the result.
+   */
+  void KNearest(const Node &node, const std::size_t k,
+                std::vector<std::size_t> &ids) const;
+
+  std::size_t Size() const { return points_.size(); }
+  bool Empty() const { return points_.empty(); }
+  void Clear() { points_.clear(); }
+
+private:
+  struct Point
+  {
+    Node node{};
+    std::size_t id{0};
+    int32_t left{-1};
+    int32_t right{-1};
+    bool split_x{true};
+  };
+
+  void Nearest(const int32_t index, const Node &node, int32_t &best,
+               int64_t &best_distance) const;
+
+  std::vector<Point> points_{};
+}; // class KDTree
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_KD_TREE_H_ */
@@ -0,0 +1,128 @@
+/**
+ * @file path_shortcutting.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "path_shortcutting.h"
+#include "random_generator.h"
+
+#include <cmath>
+#include <random>
+
+namespace planning
+{
+
+namespace
+{
+Node Interpolate(const Node &node1, const Node &node2, const double t)
+{
+  return Node(std::lround(node1.x_ + t * (node2.x_ - node1.x_)),
+              std::lround(node1.y_ + t * (node2.y_ - node1.y_)));
+}
+
+bool IsVisible(const Node &node1, const Node &node2,
+               const std::shared_ptr<Map> &map)
+{
+  return node1 == node2 || !CheckIfCollisionBetweenNodes(node1, node2, map);
+}
+} // namespace
+
+Path GreedyShortcutPath(const Path &path, const std::shared_ptr<Map> map)
+{
+  if (path.size() < 3)
+    {
+      return path;
+    }
+
+  Path shortcut_path{path.front()};
+  auto anchor{0u};
+  for (auto i = 2u; i < path.size(); i++)
+    {
+      if (!IsVisible(path[anchor], path[i], map))
+        {
+          anchor = i - 1;
+          shortcut_path.emplace_back(path[anchor]);
+        }
+    }
+  shortcut_path.emplace_back(path.back());
+  return shortcut_path;
+}
+
+Path RandomShortcutPath(const Path &path, const std::shared_ptr<Map> map,
+                        const int max_attempts, const std::uint64_t seed)
+{
+  Path shortcut_path{path};
+  RandomGenerator generator(seed);
+  std::uniform_real_distribution<> ratio(0.0, 1.0);
+
+  for (auto attempt = 0; attempt < max_attempts && shortcut_path.size() > 2;
+       attempt++)
+    {
+      // Pick a point on two different segments.
+      std::uniform_int_distribution<std::size_t> segment(
+          0, shortcut_path.size() - 2);
+      auto first{segment(generator)};
+      auto second{segment(generator)};
+      if (first == second)
+        {
+          continue;
+        }
+      if (first > second)
+        {
+          std::swap(first, second);
+        }
+      auto first_node{Interpolate(shortcut_path[first],
+                                  shortcut_path[first + 1], ratio(generator))};
+      auto second_node{Interpolate(shortcut_path[second],
+                                   shortcut_path[second + 1],
+                                   ratio(generator))};
+
+      auto old_length{EuclideanDistance(first_node, shortcut_path[first + 1]) +
+                      EuclideanDistance(shortcut_path[second], second_node)};
+      for (auto i = first + 1; i < second; i++)
+        {
+          old_length +=
+              EuclideanDistance(shortcut_path[i], shortcut_path[i + 1]);
+        }
+      if (first_node == second_node ||
+          EuclideanDistance(first_node, second_node) >= old_length ||
+          !IsVisible(first_node, second_node, map) ||
+          !IsVisible(shortcut_path[first], first_node, map) ||
+          !IsVisible(second_node, shortcut_path[second + 1], map))
+        {
+          continue;
+        }
+
+      // Replace the waypoints between both points.
+      shortcut_path.erase(shortcut_path.begin() + first + 1,
+                          shortcut_path.begin() + second + 1);
+      auto position{shortcut_path.begin() + first + 1};
+      if (second_node != *position)
+        {
+          position = shortcut_path.insert(position, second_node);
+        }
+      if (first_node != shortcut_path[first])
+        {
+          shortcut_path.insert(position, first_node);
+        }
+    }
+  return shortcut_path;
+}
+
+double PathLength(const Path &path)
+{
+  auto length{0.0};
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      length += EuclideanDistance(path[i - 1], path[i]);
+    }
+  return length;
+}
+
+} // namespace planning
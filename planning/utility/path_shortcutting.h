@@ -0,0 +1,57 @@
+/**
+ * @file path_shortcutting.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Path post-processing by shortcutting over line of sight.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_PATH_SHORTCUTTING_H_
+#define PLANNING_INCLUDE_PATH_SHORTCUTTING_H_
+
+#include "common_planning.h"
+#include "data_types.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace planning
+{
+
+/**
+ * @brief Greedy string pulling. Keeps a waypoint only when the next one is not
+ * visible from the last kept waypoint. Does one line of sight check per
+ * waypoint.
+ *
+ * @param path Path whose consecutive waypoints are collision free.
+ * @param map
+ * @return Path with the same start and goal.
+ */
+Path GreedyShortcutPath(const Path &path, const std::shared_ptr<Map> map);
+
+/**
+ * @brief Randomized shortcutting. Picks two random points on the path and
+ * replaces the part between them with a straight segment if it is collision
+ * free and shorter. Does at most three line of sight checks per attempt.
+ *
+ * @param path Path whose consecutive waypoints are collision free.
+ * @param map
+ * @param max_attempts Number of shortcuts to try.
+ * @param seed Seed of the random generator.
+ * @return Path with the same start and goal.
+ */
+Path RandomShortcutPath(const Path &path, const std::shared_ptr<Map> map,
+                        const int max_attempts, const std::uint64_t seed);
+
+/**
+ * @brief Length of path.
+ *
+ */
+double PathLength(const Path &path);
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_PATH_SHORTCUTTING_H_ */
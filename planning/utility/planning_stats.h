@@ -0,0 +1,121 @@
+/**
+ * @file planning_stats.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Counters and phase times of one query.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_PLANNING_STATS_H_
+#define PLANNING_INCLUDE_PLANNING_STATS_H_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+
+namespace planning
+{
+
+/**
+ * @brief Filled by the planner while a query runs. Fields a planner has no
+ * use for stay zero. Tree planners count every sample as an expansion.
+ *
+ */
+struct PlanningStats
+{
+  std::size_t nodes_expanded{0};
+  std::size_t nodes_generated{0};
+  std::size_t open_list_peak{0};
+  // Line of sight checks, i.e. ray casts between two nodes.
+  std::size_t collision_checks{0};
+  std::size_t neighbor_queries{0};
+  // Search nodes allocated on the heap, and growths of the tree arrays.
+  std::size_t allocations{0};
+
+  // Only tree planners and Theta* time their phases. Collision is the time
+  // spent choosing a free parent, rewire includes the checks of the rewired
+  // edges. Threaded planners add up the times of their workers.
+  std::chrono::nanoseconds sampling_time{0};
+  std::chrono::nanoseconds nearest_neighbor_time{0};
+  std::chrono::nanoseconds collision_time{0};
+  std::chrono::nanoseconds rewire_time{0};
+  std::chrono::nanoseconds total_time{0};
+
+  /**
+   * @brief Add the counters and phase times of a worker of the same query.
+   * Peaks take the maximum, total time is left to the caller.
+   *
+   */
+  PlanningStats &operator+=(const PlanningStats &stats)
+  {
+    nodes_expanded += stats.nodes_expanded;
+    nodes_generated += stats.nodes_generated;
+    open_list_peak = std::max(open_list_peak, stats.open_list_peak);
+    collision_checks += stats.collision_checks;
+    neighbor_queries += stats.neighbor_queries;
+    allocations += stats.allocations;
+    sampling_time += stats.sampling_time;
+    nearest_neighbor_time += stats.nearest_neighbor_time;
+    collision_time += stats.collision_time;
+    rewire_time += stats.rewire_time;
+    return *this;
+  }
+};
+
+/**
+ * @brief Adds its lifetime to a phase time. Two clock reads, so it is cheap
+ * enough to leave on around whole phases, not single checks.
+ *
+ */
+class PhaseTimer
+{
+public:
+  explicit PhaseTimer(std::chrono::nanoseconds &phase_time)
+      : phase_time_(phase_time), start_time_(std::chrono::steady_clock::now())
+  {
+  }
+  ~PhaseTimer()
+  {
+    phase_time_ += std::chrono::steady_clock::now() - start_time_;
+  }
+
+  PhaseTimer(const PhaseTimer &) = delete;
+  PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+private:
+  std::chrono::nanoseconds &phase_time_;
+  std::chrono::steady_clock::time_point start_time_;
+}; // class PhaseTimer
+
+/**
+ * @brief Splits consecutive phases of a loop with one clock read per phase.
+ *
+ */
+class PhaseClock
+{
+public:
+  PhaseClock() : last_time_(std::chrono::steady_clock::now()) {}
+
+  void Restart() { last_time_ = std::chrono::steady_clock::now(); }
+
+  /**
+   * @brief Add the time since the last lap or restart to phase time.
+   *
+   */
+  void Lap(std::chrono::nanoseconds &phase_time)
+  {
+    const auto now{std::chrono::steady_clock::now()};
+    phase_time += now - last_time_;
+    last_time_ = now;
+  }
+
+private:
+  std::chrono::steady_clock::time_point last_time_;
+}; // class PhaseClock
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_PLANNING_STATS_H_ */
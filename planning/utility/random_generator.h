@@ -0,0 +1,92 @@
+/**
+ * @file random_generator.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Fast seedable pseudo random number generator.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_RANDOM_GENERATOR_H_
+#define PLANNING_INCLUDE_RANDOM_GENERATOR_H_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace planning
+{
+
+/**
+ * @brief xoshiro256** generator seeded with splitmix64. Satisfies
+ * UniformRandomBitGenerator, so it also works with the std distributions.
+ * Same seed gives the same sequence on every platform.
+ */
+class RandomGenerator
+{
+public:
+  using result_type = std::uint64_t;
+
+  RandomGenerator() : RandomGenerator(0) {}
+  explicit RandomGenerator(const std::uint64_t seed) { Seed(seed); }
+
+  void Seed(std::uint64_t seed)
+  {
+    for (auto &state : state_)
+      {
+        seed += 0x9e3779b97f4a7c15ULL;
+        auto z{seed};
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        state = z ^ (z >> 31);
+      }
+  }
+
+  result_type operator()()
+  {
+    const auto result{RotateLeft(state_[1] * 5, 7) * 9};
+    const auto t{state_[1] << 17};
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = RotateLeft(state_[3], 45);
+    return result;
+  }
+
+  /**
+   * @brief Uniform double in [0, 1).
+   *
+   */
+  double Uniform() { return ((*this)() >> 11) * 0x1.0p-53; }
+
+  /**
+   * @brief Uniform integer in [0, bound). Bound must be below 2^32.
+   *
+   */
+  std::uint32_t Below(const std::uint32_t bound)
+  {
+    return static_cast<std::uint32_t>((((*this)() >> 32) * bound) >> 32);
+  }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max()
+  {
+    return std::numeric_limits<result_type>::max();
+  }
+
+private:
+  static std::uint64_t RotateLeft(const std::uint64_t x, const int k)
+  {
+    return (x << k) | (x >> (64 - k));
+  }
+
+  std::array<std::uint64_t, 4> state_{};
+}; // class RandomGenerator
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_RANDOM_GENERATOR_H_ */
@@ -0,0 +1,217 @@
+/**
+ * @file roadmap.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "roadmap.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace planning
+{
+
+namespace
+{
+
+constexpr std::uint32_t kRoadmapMagic{0x504d4452}; // "RDMP"
+constexpr std::uint32_t kRoadmapVersion{1};
+constexpr std::uint64_t kNodeBytes{2 * sizeof(std::int32_t)};
+constexpr std::uint64_t kEdgeBytes{2 * sizeof(RoadmapIndex) +
+                                   sizeof(std::uint8_t)};
+
+// FNV-1a over the occupied cells, free and visited cells are the same for a
+// roadmap.
+std::uint64_t MapFingerprint(const Map &map)
+{
+  std::uint64_t hash{0xcbf29ce484222325ULL};
+  for (auto i = 0u; i < map.GetHeight(); i++)
+    {
+      for (auto j = 0u; j < map.GetWidth(); j++)
+        {
+          hash ^= map.GetNodeState(Node(i, j)) == NodeState::kOccupied;
+          hash *= 0x100000001b3ULL;
+        }
+    }
+  return hash;
+}
+
+template <typename T> void Write(std::ostream &stream, const T &value)
+{
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> bool Read(std::istream &stream, T &value)
+{
+  return static_cast<bool>(
+      stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+// Bytes left in a seekable stream, zero if it cannot seek.
+std::uint64_t RemainingBytes(std::istream &stream)
+{
+  const auto position{stream.tellg()};
+  if (position < 0)
+    {
+      return 0;
+    }
+  stream.seekg(0, std::ios::end);
+  const auto end{stream.tellg()};
+  stream.seekg(position);
+  return end < position ? 0 : static_cast<std::uint64_t>(end - position);
+}
+
+} // namespace
+
+void Roadmap::Build(const std::vector<Node> &nodes,
+                    const std::vector<RoadmapEdge> &edges,
+                    const EdgeState state)
+{
+  Clear();
+  nodes_ = nodes;
+  offsets_.assign(nodes_.size() + 1, 0);
+  for (const auto &edge : edges)
+    {
+      offsets_[edge.first + 1]++;
+      offsets_[edge.second + 1]++;
+    }
+  for (auto i = 1u; i < offsets_.size(); i++)
+    {
+      offsets_[i] += offsets_[i - 1];
+    }
+  neighbors_.resize(offsets_.back());
+  edge_ids_.resize(offsets_.back());
+  auto next{offsets_};
+  for (auto i = 0u; i < edges.size(); i++)
+    {
+      edge_ids_[next[edges[i].first]] = i;
+      neighbors_[next[edges[i].first]++] = edges[i].second;
+      edge_ids_[next[edges[i].second]] = i;
+      neighbors_[next[edges[i].second]++] = edges[i].first;
+    }
+  states_.assign(edges.size(), state);
+  for (auto i = 0u; i < nodes_.size(); i++)
+    {
+      kd_tree_.Insert(nodes_[i], i);
+    }
+}
+
+void Roadmap::Clear()
+{
+  nodes_.clear();
+  offsets_.clear();
+  neighbors_.clear();
+  edge_ids_.clear();
+  states_.clear();
+  kd_tree_.Clear();
+}
+
+std::size_t Roadmap::FindEdge(const RoadmapIndex index,
+                              const RoadmapIndex neighbor) const
+{
+  auto edge{GetEdgeBegin(index)};
+  while (edge < GetEdgeEnd(index) && neighbors_[edge] != neighbor)
+    {
+      edge++;
+    }
+  return edge;
+}
+
+std::size_t Roadmap::CountEdges(const EdgeState state) const
+{
+  return std::count(states_.begin(), states_.end(), state);
+}
+
+void Roadmap::Save(std::ostream &stream, const Map &map) const
+{
+  Write(stream, kRoadmapMagic);
+  Write(stream, kRoadmapVersion);
+  Write(stream, static_cast<std::uint64_t>(map.GetHeight()));
+  Write(stream, static_cast<std::uint64_t>(map.GetWidth()));
+  Write(stream, MapFingerprint(map));
+  Write(stream, static_cast<std::uint64_t>(nodes_.size()));
+  Write(stream, static_cast<std::uint64_t>(GetEdgeCount()));
+  for (const auto &node : nodes_)
+    {
+      Write(stream, static_cast<std::int32_t>(node.x_));
+      Write(stream, static_cast<std::int32_t>(node.y_));
+    }
+  for (auto i = 0u; i < nodes_.size(); i++)
+    {
+      for (auto edge = GetEdgeBegin(i); edge < GetEdgeEnd(i); edge++)
+        {
+          if (i < neighbors_[edge])
+            {
+              Write(stream, static_cast<RoadmapIndex>(i));
+              Write(stream, neighbors_[edge]);
+              Write(stream, static_cast<std::uint8_t>(GetEdgeState(edge)));
+            }
+        }
+    }
+}
+
+bool Roadmap::Load(std::istream &stream, const Map &map)
+{
+  Clear();
+  std::uint32_t magic{0}, version{0};
+  std::uint64_t height{0}, width{0}, fingerprint{0}, node_count{0},
+      edge_count{0};
+  if (!Read(stream, magic) || magic != kRoadmapMagic ||
+      !Read(stream, version) || version != kRoadmapVersion ||
+      !Read(stream, height) || !Read(stream, width) ||
+      !Read(stream, fingerprint) || !Read(stream, node_count) ||
+      !Read(stream, edge_count) || height != map.GetHeight() ||
+      width != map.GetWidth() || fingerprint != MapFingerprint(map))
+    {
+      return false;
+    }
+
+  // Bound the counts by the stream before allocating for them. Indices of
+  // every node must fit in RoadmapIndex.
+  const auto remaining_bytes{RemainingBytes(stream)};
+  if (node_count > std::numeric_limits<RoadmapIndex>::max() ||
+      node_count > remaining_bytes / kNodeBytes ||
+      edge_count > (remaining_bytes - node_count * kNodeBytes) / kEdgeBytes)
+    {
+      return false;
+    }
+
+  // Nodes must lie on the map and edges must join two different nodes.
+  std::vector<Node> nodes(node_count);
+  for (auto &node : nodes)
+    {
+      std::int32_t x{0}, y{0};
+      if (!Read(stream, x) || !Read(stream, y) || x < 0 ||
+          static_cast<std::uint64_t>(x) >= height || y < 0 ||
+          static_cast<std::uint64_t>(y) >= width)
+        {
+          return false;
+        }
+      node = Node(x, y);
+    }
+  std::vector<RoadmapEdge> edges(edge_count);
+  std::vector<EdgeState> states(edge_count);
+  for (auto i = 0u; i < edge_count; i++)
+    {
+      std::uint8_t state{0};
+      if (!Read(stream, edges[i].first) || !Read(stream, edges[i].second) ||
+          !Read(stream, state) || edges[i].first >= node_count ||
+          edges[i].second >= node_count || edges[i].first == edges[i].second ||
+          state > static_cast<std::uint8_t>(EdgeState::kInvalid))
+        {
+          return false;
+        }
+      states[i] = static_cast<EdgeState>(state);
+    }
+  Build(nodes, edges);
+  states_ = states;
+  return true;
+}
+
+} // namespace planning
@@ -0,0 +1,143 @@
+/**
+ * @file roadmap.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Undirected roadmap graph for multi-query planners.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_ROADMAP_H_
+#define PLANNING_INCLUDE_ROADMAP_H_
+
+#include "common_planning.h"
+#include "data_types.h"
+#include "kd_tree.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace planning
+{
+
+using RoadmapIndex = std::uint32_t;
+using RoadmapEdge = std::pair<RoadmapIndex, RoadmapIndex>;
+
+/**
+ * @brief Collision state of a roadmap edge. Lazy roadmaps start unchecked.
+ *
+ */
+enum class EdgeState : std::uint8_t
+{
+  kUnchecked,
+  kValid,
+  kInvalid
+};
+
+/**
+ * @brief Roadmap nodes with their edges in compressed adjacency arrays, and a
+ * KD-tree over the nodes whose ids are roadmap indices. Nodes and adjacency
+ * are read only after Build. Edge states are not: lazy queries write them
+ * with SetEdgeState, so they need their own synchronization to run at the
+ * same time.
+ */
+class Roadmap
+{
+public:
+  /**
+   * @brief Replace the roadmap. Each edge is given once and stored in both
+   * directions.
+   *
+   * @param state Initial state of every edge.
+   */
+  void Build(const std::vector<Node> &nodes,
+             const std::vector<RoadmapEdge> &edges,
+             const EdgeState state = EdgeState::kValid);
+
+  std::size_t Size() const { return nodes_.size(); }
+  bool Empty() const { return nodes_.empty(); }
+  void Clear();
+
+  const Node &GetNode(const RoadmapIndex index) const { return nodes_[index]; }
+
+  /**
+   * @brief Neighbors of index are GetNeighbor(e) for e in [GetEdgeBegin(index),
+   * GetEdgeEnd(index)).
+   *
+   */
+  std::size_t GetEdgeBegin(const RoadmapIndex index) const
+  {
+    return offsets_[index];
+  }
+  std::size_t GetEdgeEnd(const RoadmapIndex index) const
+  {
+    return offsets_[index + 1];
+  }
+  RoadmapIndex GetNeighbor(const std::size_t edge) const
+  {
+    return neighbors_[edge];
+  }
+  std::size_t GetEdgeCount() const { return neighbors_.size() / 2; }
+
+  /**
+   * @brief State of the undirected edge behind adjacency entry edge, shared
+   * by both of its directions.
+   *
+   */
+  EdgeState GetEdgeState(const std::size_t edge) const
+  {
+    return states_[edge_ids_[edge]];
+  }
+  void SetEdgeState(const std::size_t edge, const EdgeState state)
+  {
+    states_[edge_ids_[edge]] = state;
+  }
+
+  /**
+   * @brief Adjacency entry of the edge from index to neighbor,
+   * GetEdgeEnd(index) if there is none.
+   *
+   */
+  std::size_t FindEdge(const RoadmapIndex index,
+                       const RoadmapIndex neighbor) const;
+
+  std::size_t CountEdges(const EdgeState state) const;
+
+  const KDTree &GetKDTree() const { return kd_tree_; }
+
+  /**
+   * @brief Write the roadmap in binary form together with a fingerprint of
+   * map.
+   *
+   */
+  void Save(std::ostream &stream, const Map &map) const;
+
+  /**
+   * @brief Read a roadmap written by Save. Stream must be seekable so the
+   * counts can be checked before allocating. Fails if it was saved by
+   * another format version or for another map, or has nodes off the map,
+   * self loops, or indices or edge states out of range. Roadmap is cleared on
+   * failure.
+   *
+   * @return true if the roadmap is read.
+   */
+  bool Load(std::istream &stream, const Map &map);
+
+private:
+  std::vector<Node> nodes_{};
+  std::vector<std::size_t> offsets_{};
+  std::vector<RoadmapIndex> neighbors_{};
+  std::vector<std::size_t> edge_ids_{};
+  std::vector<EdgeState> states_{};
+  KDTree kd_tree_{};
+}; // class Roadmap
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_ROADMAP_H_ */
@@ -0,0 +1,115 @@
+/**
+ * @file sampler.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "sampler.h"
+
+#include <cmath>
+
+namespace planning
+{
+
+Sampler::Sampler(const std::uint64_t seed) : generator_(seed) {}
+
+void Sampler::SetMap(const std::shared_ptr<Map> map)
+{
+  map_ = map;
+  free_nodes_ = map->GetFreeNodes();
+  batch_.clear();
+  batch_index_ = 0;
+}
+
+Node Sampler::FreeNode()
+{
+  if (batch_index_ == batch_.size())
+    {
+      FillBatch();
+    }
+  return batch_[batch_index_++];
+}
+
+void Sampler::FreeNodes(const std::size_t count, std::vector<Node> &nodes)
+{
+  const auto &free_nodes{*free_nodes_};
+  if (free_nodes.empty())
+    {
+      nodes.clear();
+      return;
+    }
+  nodes.resize(count);
+  const auto size{static_cast<std::uint32_t>(free_nodes.size())};
+  for (auto &node : nodes)
+    {
+      node = free_nodes[generator_.Below(size)];
+    }
+}
+
+Node Sampler::InformedNode(const Node &focus1, const Node &focus2,
+                           const double transverse_diameter)
+{
+  const auto focal_distance{EuclideanDistance(focus1, focus2)};
+  if (transverse_diameter <= focal_distance)
+    {
+      return FreeNode();
+    }
+
+  const auto semi_major{transverse_diameter / 2.0};
+  const auto semi_minor{
+      std::sqrt(transverse_diameter * transverse_diameter -
+                focal_distance * focal_distance) /
+      2.0};
+  const auto cos_axis{
+      focal_distance > 0.0 ? (focus2.x_ - focus1.x_) / focal_distance : 1.0};
+  const auto sin_axis{
+      focal_distance > 0.0 ? (focus2.y_ - focus1.y_) / focal_distance : 0.0};
+  const auto is_ellipse_smaller{M_PI * semi_major * semi_minor <
+                                map_->GetHeight() * map_->GetWidth()};
+  for (auto attempt = 0; attempt < kMaxInformedAttempts; attempt++)
+    {
+      if (!is_ellipse_smaller)
+        {
+          auto node{FreeNode()};
+          if (EuclideanDistance(node, focus1) +
+                  EuclideanDistance(node, focus2) <
+              transverse_diameter)
+            {
+              return node;
+            }
+          continue;
+        }
+
+      // Uniform point in the unit disk, stretched and rotated onto the
+      // ellipse.
+      const auto radius{std::sqrt(generator_.Uniform())};
+      const auto angle{2.0 * M_PI * generator_.Uniform()};
+      const auto major{semi_major * radius * std::cos(angle)};
+      const auto minor{semi_minor * radius * std::sin(angle)};
+      auto node{Node(static_cast<int>(std::lround(
+                         (focus1.x_ + focus2.x_) / 2.0 + major * cos_axis -
+                         minor * sin_axis)),
+                     static_cast<int>(std::lround(
+                         (focus1.y_ + focus2.y_) / 2.0 + major * sin_axis +
+                         minor * cos_axis)))};
+      if (IsInbound(node, map_) &&
+          map_->GetNodeState(node) != NodeState::kOccupied)
+        {
+          return node;
+        }
+    }
+  return FreeNode();
+}
+
+void Sampler::FillBatch()
+{
+  FreeNodes(kBatchSize, batch_);
+  batch_index_ = 0;
+}
+
+} // namespace planning
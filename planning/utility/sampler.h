@@ -0,0 +1,87 @@
+/**
+ * @file sampler.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Free space sampler for tree based planners.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_SAMPLER_H_
+#define PLANNING_INCLUDE_SAMPLER_H_
+
+#include "common_planning.h"
+#include "random_generator.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace planning
+{
+
+/**
+ * @brief Samples free cells of a map uniformly without rejection. The free
+ * cell index of the map is shared read only, see Map::GetFreeNodes. Samples
+ * are generated in batches from a seeded generator so runs are reproducible.
+ */
+class Sampler
+{
+public:
+  explicit Sampler(const std::uint64_t seed);
+
+  /**
+   * @brief Sample the cells of map that are free at this point.
+   *
+   */
+  void SetMap(const std::shared_ptr<Map> map);
+
+  /**
+   * @brief Random free node. Map must have a free cell, see
+   * GetFreeNodeCount.
+   *
+   */
+  Node FreeNode();
+
+  /**
+   * @brief Fill nodes with count random free nodes, none if map has no free
+   * cell.
+   *
+   */
+  void FreeNodes(const std::size_t count, std::vector<Node> &nodes);
+
+  /**
+   * @brief Random non-occupied node inside the ellipse with foci focus1 and
+   * focus2, i.e. the nodes whose distances to the foci sum to less than
+   * transverse_diameter. Samples the ellipse directly while it is smaller than
+   * the map, otherwise rejects free nodes outside of it. Falls back to
+   * FreeNode if the ellipse is degenerate or no node is found, so map must
+   * have a free cell.
+   *
+   */
+  Node InformedNode(const Node &focus1, const Node &focus2,
+                    const double transverse_diameter);
+
+  std::size_t GetFreeNodeCount() const { return free_nodes_->size(); }
+  RandomGenerator &GetGenerator() { return generator_; }
+
+private:
+  void FillBatch();
+
+  static constexpr std::size_t kBatchSize{256};
+  static constexpr int kMaxInformedAttempts{64};
+
+  RandomGenerator generator_;
+  std::shared_ptr<Map> map_{};
+  std::shared_ptr<const std::vector<Node>> free_nodes_{
+      std::make_shared<std::vector<Node>>()};
+  std::vector<Node> batch_{};
+  std::size_t batch_index_{0};
+}; // class Sampler
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_SAMPLER_H_ */
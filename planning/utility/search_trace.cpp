@@ -0,0 +1,318 @@
+/**
+ * @file search_trace.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "search_trace.h"
+#include "common_planning.h"
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace planning
+{
+namespace
+{
+
+constexpr std::uint32_t kTraceMagic{0x43525453}; // "STRC"
+constexpr std::uint32_t kTraceVersion{1};
+
+template <typename T> void Write(std::ostream &stream, const T &value)
+{
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> bool Read(std::istream &stream, T &value)
+{
+  return static_cast<bool>(
+      stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+bool ReadVarint(std::istream &stream, std::uint64_t &value)
+{
+  value = 0;
+  for (auto shift = 0u; shift < 64; shift += 7)
+    {
+      const auto byte{stream.get()};
+      if (byte == std::istream::traits_type::eof())
+        {
+          return false;
+        }
+      value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        {
+          return true;
+        }
+    }
+  return false;
+}
+
+std::int64_t ZigzagDecode(const std::uint64_t value)
+{
+  return static_cast<std::int64_t>(value >> 1) ^
+         -static_cast<std::int64_t>(value & 1);
+}
+
+bool ReadDelta(std::istream &stream, Node &last_node)
+{
+  std::uint64_t dx{0}, dy{0};
+  if (!ReadVarint(stream, dx) || !ReadVarint(stream, dy))
+    {
+      return false;
+    }
+  last_node = Node(last_node.x_ + ZigzagDecode(dx),
+                   last_node.y_ + ZigzagDecode(dy));
+  return true;
+}
+
+} // namespace
+
+SearchTraceWriter::SearchTraceWriter(std::ostream &stream,
+                                     const std::string &planner_name,
+                                     const Map &map)
+    : stream_(stream)
+{
+  buffer_.reserve(kBufferSize);
+  Write(stream_, kTraceMagic);
+  Write(stream_, kTraceVersion);
+  Write(stream_, static_cast<std::uint64_t>(map.GetHeight()));
+  Write(stream_, static_cast<std::uint64_t>(map.GetWidth()));
+  Write(stream_, static_cast<std::uint32_t>(planner_name.size()));
+  stream_.write(planner_name.data(), planner_name.size());
+}
+
+void SearchTraceWriter::AddExpansion(const Node &node)
+{
+  buffer_.push_back(static_cast<char>(TraceEventType::kExpansion));
+  PutDelta(node);
+  node_count_++;
+  FlushIfFull();
+}
+
+void SearchTraceWriter::AddEdge(const Node &node, const std::size_t parent)
+{
+  buffer_.push_back(static_cast<char>(TraceEventType::kEdge));
+  PutDelta(node);
+  // Zero marks a root, parents always come before their children.
+  PutVarint(parent == kNoTraceParent ? 0 : node_count_ - parent);
+  node_count_++;
+  FlushIfFull();
+}
+
+void SearchTraceWriter::AddRewire(const std::size_t index,
+                                  const std::size_t parent)
+{
+  buffer_.push_back(static_cast<char>(TraceEventType::kRewire));
+  PutVarint(node_count_ - index);
+  PutVarint(node_count_ - parent);
+  FlushIfFull();
+}
+
+void SearchTraceWriter::AddPath(const Path &path)
+{
+  buffer_.push_back(static_cast<char>(TraceEventType::kPath));
+  PutVarint(path.size());
+  for (const auto &node : path)
+    {
+      PutDelta(node);
+    }
+  FlushIfFull();
+}
+
+bool SearchTraceWriter::Flush()
+{
+  stream_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+  return static_cast<bool>(stream_.flush());
+}
+
+void SearchTraceWriter::PutVarint(std::uint64_t value)
+{
+  while (value >= 0x80)
+    {
+      buffer_.push_back(static_cast<char>((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+  buffer_.push_back(static_cast<char>(value));
+}
+
+void SearchTraceWriter::PutDelta(const Node &node)
+{
+  // Zigzag keeps small negative deltas in one byte.
+  const std::int64_t dx{node.x_ - last_node_.x_};
+  const std::int64_t dy{node.y_ - last_node_.y_};
+  PutVarint((static_cast<std::uint64_t>(dx) << 1) ^ (dx >> 63));
+  PutVarint((static_cast<std::uint64_t>(dy) << 1) ^ (dy >> 63));
+  last_node_ = node;
+}
+
+void SearchTraceWriter::FlushIfFull()
+{
+  if (buffer_.size() >= kBufferSize)
+    {
+      Flush();
+    }
+}
+
+void WriteLogTrace(const Log &log, SearchTraceWriter &trace)
+{
+  std::unordered_set<const NodeParent *> logged;
+  for (const auto &node_parent : log.first)
+    {
+      logged.insert(node_parent.get());
+    }
+
+  // Walk up to the first written or unlogged ancestor, then write the chain
+  // top-down. The chain is bounded by the log size in case of a cycle.
+  std::unordered_map<const NodeParent *, std::size_t> indices;
+  std::vector<const NodeParent *> chain;
+  for (const auto &node_parent : log.first)
+    {
+      chain.clear();
+      for (auto current = node_parent.get();
+           current != nullptr && logged.count(current) != 0 &&
+           indices.count(current) == 0 && chain.size() < log.first.size();
+           current = current->parent.get())
+        {
+          chain.push_back(current);
+        }
+      for (auto it = chain.rbegin(); it != chain.rend(); it++)
+        {
+          const auto parent{indices.find((*it)->parent.get())};
+          const auto index{trace.GetNodeCount()};
+          trace.AddEdge((*it)->node, parent != indices.end() ? parent->second
+                                                             : kNoTraceParent);
+          indices.emplace(*it, index);
+        }
+    }
+}
+
+bool ReadSearchTrace(std::istream &stream, SearchTrace &trace)
+{
+  trace = SearchTrace{};
+  std::uint32_t magic{0}, version{0}, name_size{0};
+  std::uint64_t height{0}, width{0};
+  if (!Read(stream, magic) || magic != kTraceMagic ||
+      !Read(stream, version) || version != kTraceVersion ||
+      !Read(stream, height) || !Read(stream, width) ||
+      !Read(stream, name_size))
+    {
+      return false;
+    }
+  trace.height = height;
+  trace.width = width;
+  trace.planner_name.resize(name_size);
+  if (!stream.read(&trace.planner_name[0], name_size))
+    {
+      return false;
+    }
+
+  Node last_node{0, 0};
+  // Rewire records only carry indices.
+  std::vector<Node> nodes;
+  for (auto type{stream.get()}; type != std::istream::traits_type::eof();
+       type = stream.get())
+    {
+      TraceEvent event;
+      event.type = static_cast<TraceEventType>(type);
+      std::uint64_t index{0}, parent{0};
+      switch (event.type)
+        {
+        case TraceEventType::kExpansion:
+          if (!ReadDelta(stream, last_node))
+            {
+              return false;
+            }
+          event.node = last_node;
+          event.index = nodes.size();
+          nodes.push_back(last_node);
+          break;
+        case TraceEventType::kEdge:
+          if (!ReadDelta(stream, last_node) || !ReadVarint(stream, parent) ||
+              parent > nodes.size())
+            {
+              return false;
+            }
+          event.node = last_node;
+          event.index = nodes.size();
+          event.parent = parent == 0 ? kNoTraceParent : nodes.size() - parent;
+          nodes.push_back(last_node);
+          break;
+        case TraceEventType::kRewire:
+          if (!ReadVarint(stream, index) || !ReadVarint(stream, parent) ||
+              index == 0 || index > nodes.size() || parent == 0 ||
+              parent > nodes.size())
+            {
+              return false;
+            }
+          event.index = nodes.size() - index;
+          event.parent = nodes.size() - parent;
+          event.node = nodes[event.index];
+          break;
+        case TraceEventType::kPath:
+          if (!ReadVarint(stream, index))
+            {
+              return false;
+            }
+          trace.path.clear();
+          for (auto i = 0u; i < index; i++)
+            {
+              if (!ReadDelta(stream, last_node))
+                {
+                  return false;
+                }
+              trace.path.push_back(last_node);
+            }
+          continue;
+        default:
+          return false;
+        }
+      trace.events.push_back(event);
+    }
+  return true;
+}
+
+void ReplaySearchTrace(const SearchTrace &trace, const std::size_t event_count,
+                       LogCursor &cursor, Log &log)
+{
+  if (cursor.index == 0)
+    {
+      log = Log{};
+    }
+  const auto end{std::min(event_count, trace.events.size())};
+  auto &nodes{log.first};
+  for (; cursor.index < end; cursor.index++)
+    {
+      const auto &event{trace.events[cursor.index]};
+      auto parent{event.parent != kNoTraceParent ? nodes[event.parent]
+                                                 : nullptr};
+      if (event.type == TraceEventType::kRewire)
+        {
+          nodes[event.index]->parent = parent;
+        }
+      else
+        {
+          nodes.emplace_back(std::make_shared<NodeParent>(event.node, parent));
+        }
+    }
+  if (cursor.index == trace.events.size() && log.second == nullptr &&
+      !trace.path.empty())
+    {
+      std::shared_ptr<NodeParent> goal{};
+      for (const auto &node : trace.path)
+        {
+          goal = std::make_shared<NodeParent>(node, goal);
+        }
+      log.second = goal;
+    }
+}
+
+} // namespace planning
@@ -0,0 +1,138 @@
+/**
+ * @file search_trace.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Compact binary record of one search, for offline replay.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_SEARCH_TRACE_H_
+#define PLANNING_INCLUDE_SEARCH_TRACE_H_
+
+#include "data_types.h"
+#include "i_planning.h"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace planning
+{
+class Map;
+
+enum class TraceEventType : std::uint8_t
+{
+  kExpansion = 1,
+  kEdge,
+  kRewire,
+  kPath
+};
+
+constexpr std::size_t kNoTraceParent{std::numeric_limits<std::size_t>::max()};
+
+/**
+ * @brief Expansions and edges add a node at the next index, counted over both.
+ * Edges and rewires link index to parent. Path events are not stored here.
+ *
+ */
+struct TraceEvent
+{
+  TraceEventType type{TraceEventType::kExpansion};
+  Node node{};
+  std::size_t index{0};
+  std::size_t parent{kNoTraceParent};
+};
+
+struct SearchTrace
+{
+  std::string planner_name{};
+  std::size_t height{0};
+  std::size_t width{0};
+  std::vector<TraceEvent> events{};
+  Path path{};
+};
+
+/**
+ * @brief Writes a trace to stream. Records are a one byte type followed by
+ * varints; coordinates are zigzag deltas from the previous node and parents
+ * are distances back from the node, so most records take 3 to 5 bytes.
+ * Records are buffered and written in blocks. Stream must outlive the writer.
+ */
+class SearchTraceWriter
+{
+public:
+  SearchTraceWriter(std::ostream &stream, const std::string &planner_name,
+                    const Map &map);
+  ~SearchTraceWriter() { Flush(); }
+
+  SearchTraceWriter(const SearchTraceWriter &) = delete;
+  SearchTraceWriter &operator=(const SearchTraceWriter &) = delete;
+
+  void AddExpansion(const Node &node);
+
+  /**
+   * @brief Add node at index GetNodeCount() with parent, kNoTraceParent for a
+   * root.
+   *
+   */
+  void AddEdge(const Node &node, const std::size_t parent);
+  void AddRewire(const std::size_t index, const std::size_t parent);
+  void AddPath(const Path &path);
+
+  std::size_t GetNodeCount() const { return node_count_; }
+
+  /**
+   * @brief Write buffered records to stream.
+   *
+   * @return false if the stream failed.
+   */
+  bool Flush();
+
+private:
+  static constexpr std::size_t kBufferSize{1 << 16};
+
+  void PutVarint(std::uint64_t value);
+  void PutDelta(const Node &node);
+  void FlushIfFull();
+
+  std::ostream &stream_;
+  std::vector<char> buffer_{};
+  Node last_node_{0, 0};
+  std::size_t node_count_{0};
+}; // class SearchTraceWriter
+
+/**
+ * @brief Write a finished log as edges, for planners without a context that
+ * only keep the log of their last query. Parents are written before their
+ * children and a node whose parent is not in the log becomes a root. The
+ * order of the search is lost.
+ *
+ */
+void WriteLogTrace(const Log &log, SearchTraceWriter &trace);
+
+/**
+ * @brief Read a trace written by SearchTraceWriter. The last path recorded
+ * is kept.
+ *
+ * @return true if the whole trace is read.
+ */
+bool ReadSearchTrace(std::istream &stream, SearchTrace &trace);
+
+/**
+ * @brief Bring log up to date with the first event_count events of trace, see
+ * ILogging::ReadLog. The path of trace is set as goal once every event is
+ * read.
+ *
+ */
+void ReplaySearchTrace(const SearchTrace &trace, const std::size_t event_count,
+                       LogCursor &cursor, Log &log);
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_SEARCH_TRACE_H_ */
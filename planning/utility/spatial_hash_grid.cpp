@@ -0,0 +1,94 @@
+/**
+ * @file spatial_hash_grid.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "spatial_hash_grid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace planning
+{
+
+SpatialHashGrid::SpatialHashGrid(const double cell_size,
+                                 const std::size_t height,
+                                 const std::size_t width)
+    : cell_size_(std::max(cell_size, 1.0))
+{
+  rows_ = static_cast<int>(std::ceil(height / cell_size_)) + 1;
+  columns_ = static_cast<int>(std::ceil(width / cell_size_)) + 1;
+  buckets_.resize(rows_ * columns_);
+}
+
+void SpatialHashGrid::Insert(const Node &node, const std::size_t id)
+{
+  buckets_[Row(node.x_) * columns_ + Column(node.y_)].push_back({node, id});
+  size_++;
+}
+
+void SpatialHashGrid::Remove(const Node &node, const std::size_t id)
+{
+  auto &bucket{buckets_[Row(node.x_) * columns_ + Column(node.y_)]};
+  auto entry{std::find_if(bucket.begin(), bucket.end(),
+                          [id](const Entry &entry) { return entry.id == id; })};
+  if (entry == bucket.end())
+    {
+      return;
+    }
+  *entry = bucket.back();
+  bucket.pop_back();
+  size_--;
+}
+
+void SpatialHashGrid::Radius(const Node &node, const double radius,
+                             std::vector<std::size_t> &ids) const
+{
+  ids.clear();
+  const auto squared_radius{radius * radius};
+  for (auto row = Row(node.x_ - radius); row <= Row(node.x_ + radius); row++)
+    {
+      for (auto column = Column(node.y_ - radius);
+           column <= Column(node.y_ + radius); column++)
+        {
+          for (const auto &entry : buckets_[row * columns_ + column])
+            {
+              double dx = entry.node.x_ - node.x_;
+              double dy = entry.node.y_ - node.y_;
+              if (dx * dx + dy * dy < squared_radius)
+                {
+                  ids.emplace_back(entry.id);
+                }
+            }
+        }
+    }
+}
+
+void SpatialHashGrid::Clear()
+{
+  for (auto &bucket : buckets_)
+    {
+      bucket.clear();
+    }
+  size_ = 0;
+}
+
+int SpatialHashGrid::Row(const double x) const
+{
+  return std::clamp(static_cast<int>(std::floor(x / cell_size_)), 0,
+                    rows_ - 1);
+}
+
+int SpatialHashGrid::Column(const double y) const
+{
+  return std::clamp(static_cast<int>(std::floor(y / cell_size_)), 0,
+                    columns_ - 1);
+}
+
+} // namespace planning
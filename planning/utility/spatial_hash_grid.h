@@ -0,0 +1,74 @@
+/**
+ * @file spatial_hash_grid.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Uniform bucket grid for radius queries.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_SPATIAL_HASH_GRID_H_
+#define PLANNING_INCLUDE_SPATIAL_HASH_GRID_H_
+
+#include "data_types.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace planning
+{
+
+/**
+ * @brief Points bucketed by a uniform grid over the map. A radius query only
+ * visits the buckets overlapping the query circle, i.e. 3x3 buckets when the
+ * radius is not larger than the cell size.
+ */
+class SpatialHashGrid
+{
+public:
+  SpatialHashGrid(const double cell_size, const std::size_t height,
+                  const std::size_t width);
+
+  void Insert(const Node &node, const std::size_t id);
+
+  /**
+   * @brief Remove point with id. No-op if it is not in the bucket of node.
+   *
+   */
+  void Remove(const Node &node, const std::size_t id);
+
+  /**
+   * @brief Get ids of the points closer than radius to node.
+   *
+   * @param node
+   * @param radius
+   * @param ids Cleared, then filled with the result.
+   */
+  void Radius(const Node &node, const double radius,
+              std::vector<std::size_t> &ids) const;
+
+  std::size_t Size() const { return size_; }
+  void Clear();
+
+private:
+  struct Entry
+  {
+    Node node{};
+    std::size_t id{0};
+  };
+
+  int Row(const double x) const;
+  int Column(const double y) const;
+
+  double cell_size_{1.0};
+  int rows_{0};
+  int columns_{0};
+  std::size_t size_{0};
+  std::vector<std::vector<Entry>> buckets_{};
+}; // class SpatialHashGrid
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_SPATIAL_HASH_GRID_H_ */
@@ -0,0 +1,53 @@
+/**
+ * @file termination_condition.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "termination_condition.h"
+
+namespace planning
+{
+
+void TerminationCondition::Start()
+{
+  start_time_ = Clock::now();
+  improvement_time_ = start_time_;
+  best_cost_ = std::numeric_limits<double>::infinity();
+  stalled_iterations_ = 0;
+}
+
+bool TerminationCondition::ShouldStop(const double cost)
+{
+  const auto is_timed{time_budget_.count() > 0 || stall_duration_.count() > 0};
+  const auto now{is_timed ? Clock::now() : Clock::time_point{}};
+  if (time_budget_.count() > 0 && now - start_time_ >= time_budget_)
+    {
+      return true;
+    }
+
+  if (cost < best_cost_)
+    {
+      best_cost_ = cost;
+      improvement_time_ = now;
+      stalled_iterations_ = 0;
+      return target_cost_ > 0.0 && best_cost_ <= target_cost_;
+    }
+
+  // Stall rules only apply once there is a path to improve.
+  if (best_cost_ == std::numeric_limits<double>::infinity())
+    {
+      return false;
+    }
+  stalled_iterations_++;
+  return (stall_iterations_ > 0 && stalled_iterations_ >= stall_iterations_) ||
+         (stall_duration_.count() > 0 &&
+          now - improvement_time_ >= stall_duration_);
+}
+
+} // namespace planning
@@ -0,0 +1,86 @@
+/**
+ * @file termination_condition.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Stopping rules for anytime planners.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_TERMINATION_CONDITION_H_
+#define PLANNING_INCLUDE_TERMINATION_CONDITION_H_
+
+#include <chrono>
+#include <limits>
+
+namespace planning
+{
+
+/**
+ * @brief Decides when an anytime planner stops before its iteration limit.
+ * Every rule is disabled by a zero value, so a default constructed condition
+ * never stops the planner.
+ */
+class TerminationCondition
+{
+public:
+  /**
+   * @brief Stop once time budget has passed since Start.
+   *
+   */
+  void SetTimeBudget(const std::chrono::milliseconds time_budget)
+  {
+    time_budget_ = time_budget;
+  }
+
+  /**
+   * @brief Stop once the goal cost is at most target cost.
+   *
+   */
+  void SetTargetCost(const double target_cost) { target_cost_ = target_cost; }
+
+  /**
+   * @brief Stop once a path is found and its cost has not improved for
+   * iterations calls of ShouldStop or for duration, whichever comes first.
+   *
+   */
+  void SetStallLimit(const int iterations,
+                     const std::chrono::milliseconds duration)
+  {
+    stall_iterations_ = iterations;
+    stall_duration_ = duration;
+  }
+
+  /**
+   * @brief Reset the clock and the best cost at the start of a query.
+   *
+   */
+  void Start();
+
+  /**
+   * @brief Called once per iteration with the current goal cost, infinity
+   * while there is no path.
+   *
+   * @return true if the planner should stop.
+   */
+  bool ShouldStop(const double cost);
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  std::chrono::milliseconds time_budget_{0};
+  double target_cost_{0.0};
+  int stall_iterations_{0};
+  std::chrono::milliseconds stall_duration_{0};
+
+  Clock::time_point start_time_{};
+  Clock::time_point improvement_time_{};
+  double best_cost_{std::numeric_limits<double>::infinity()};
+  int stalled_iterations_{0};
+}; // class TerminationCondition
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_TERMINATION_CONDITION_H_ */
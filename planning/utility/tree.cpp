@@ -0,0 +1,261 @@
+/**
+ * @file tree.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "tree.h"
+
+#include <cstdint>
+
+namespace planning
+{
+
+namespace
+{
+
+constexpr std::uint32_t kTreeMagic{0x45455254}; // "TREE"
+
+template <typename T>
+void WriteArray(std::ostream &stream, const std::vector<T> &array)
+{
+  stream.write(reinterpret_cast<const char *>(array.data()),
+               array.size() * sizeof(T));
+}
+
+template <typename T>
+bool ReadArray(std::istream &stream, std::vector<T> &array,
+               const std::size_t size)
+{
+  array.resize(size);
+  return static_cast<bool>(stream.read(reinterpret_cast<char *>(array.data()),
+                                       size * sizeof(T)));
+}
+
+// Bytes left in a seekable stream, zero if it cannot seek.
+std::uint64_t RemainingBytes(std::istream &stream)
+{
+  const auto position{stream.tellg()};
+  if (position < 0)
+    {
+      return 0;
+    }
+  stream.seekg(0, std::ios::end);
+  const auto end{stream.tellg()};
+  stream.seekg(position);
+  return end < position ? 0 : static_cast<std::uint64_t>(end - position);
+}
+
+} // namespace
+
+NodeIndex Tree::AddNode(const Node &node, const NodeIndex parent,
+                        const Cost &cost)
+{
+  const auto index{Size()};
+  x_.emplace_back(node.x_);
+  y_.emplace_back(node.y_);
+  parent_.emplace_back(parent);
+  first_child_.emplace_back(kInvalidNodeIndex);
+  next_sibling_.emplace_back(kInvalidNodeIndex);
+  cost_.emplace_back(cost);
+  if (parent != kInvalidNodeIndex)
+    {
+      next_sibling_[index] = first_child_[parent];
+      first_child_[parent] = index;
+    }
+  return index;
+}
+
+void Tree::SetParent(const NodeIndex index, const NodeIndex parent)
+{
+  Unlink(index);
+  parent_[index] = parent;
+  next_sibling_[index] = first_child_[parent];
+  first_child_[parent] = index;
+}
+
+void Tree::Reserve(const std::size_t size)
+{
+  x_.reserve(size);
+  y_.reserve(size);
+  parent_.reserve(size);
+  first_child_.reserve(size);
+  next_sibling_.reserve(size);
+  cost_.reserve(size);
+}
+
+void Tree::Clear()
+{
+  x_.clear();
+  y_.clear();
+  parent_.clear();
+  first_child_.clear();
+  next_sibling_.clear();
+  cost_.clear();
+}
+
+Path Tree::ReconstructPath(const NodeIndex index) const
+{
+  Path path;
+  if (index == kInvalidNodeIndex)
+    {
+      return path;
+    }
+  for (auto current = index; current != kInvalidNodeIndex;
+       current = parent_[current])
+    {
+      path.emplace_back(x_[current], y_[current]);
+    }
+  return Path(path.rbegin(), path.rend());
+}
+
+std::vector<std::shared_ptr<NodeParent>> Tree::ToNodeParents() const
+{
+  std::vector<std::shared_ptr<NodeParent>> nodes;
+  nodes.reserve(Size());
+  for (auto i = 0u; i < Size(); i++)
+    {
+      nodes.emplace_back(
+          std::make_shared<NodeParent>(GetNode(i), nullptr, cost_[i]));
+    }
+  for (auto i = 0u; i < Size(); i++)
+    {
+      if (parent_[i] != kInvalidNodeIndex)
+        {
+          nodes[i]->parent = nodes[parent_[i]];
+        }
+    }
+  return nodes;
+}
+
+void Tree::Save(std::ostream &stream) const
+{
+  const std::uint64_t size{Size()};
+  stream.write(reinterpret_cast<const char *>(&kTreeMagic),
+               sizeof(kTreeMagic));
+  stream.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  WriteArray(stream, x_);
+  WriteArray(stream, y_);
+  WriteArray(stream, parent_);
+  WriteArray(stream, first_child_);
+  WriteArray(stream, next_sibling_);
+  WriteArray(stream, cost_);
+}
+
+bool Tree::Load(std::istream &stream)
+{
+  std::uint32_t magic{0};
+  std::uint64_t size{0};
+  stream.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+  stream.read(reinterpret_cast<char *>(&size), sizeof(size));
+  // Bound the size by the stream before allocating for it.
+  constexpr auto kNodeBytes{2 * sizeof(int) + 3 * sizeof(NodeIndex) +
+                            sizeof(Cost)};
+  auto is_loaded{stream && magic == kTreeMagic &&
+                 size <= RemainingBytes(stream) / kNodeBytes &&
+                 ReadArray(stream, x_, size) &&
+                 ReadArray(stream, y_, size) &&
+                 ReadArray(stream, parent_, size) &&
+                 ReadArray(stream, first_child_, size) &&
+                 ReadArray(stream, next_sibling_, size) &&
+                 ReadArray(stream, cost_, size) && IsConsistent()};
+  if (!is_loaded)
+    {
+      Clear();
+    }
+  return is_loaded;
+}
+
+bool Tree::IsConsistent() const
+{
+  const auto size{Size()};
+  auto is_index = [size](const NodeIndex index) {
+    return index < size || index == kInvalidNodeIndex;
+  };
+  for (auto i = 0u; i < size; i++)
+    {
+      if (!is_index(parent_[i]) || !is_index(first_child_[i]) ||
+          !is_index(next_sibling_[i]))
+        {
+          return false;
+        }
+    }
+
+  // Child lists hold each node with a parent exactly once, under it.
+  std::vector<bool> is_listed(size, false);
+  for (auto i = 0u; i < size; i++)
+    {
+      for (auto child = first_child_[i]; child != kInvalidNodeIndex;
+           child = next_sibling_[child])
+        {
+          if (is_listed[child] || parent_[child] != i)
+            {
+              return false;
+            }
+          is_listed[child] = true;
+        }
+    }
+  for (auto i = 0u; i < size; i++)
+    {
+      if (is_listed[i] != (parent_[i] != kInvalidNodeIndex))
+        {
+          return false;
+        }
+    }
+
+  // Every parent chain ends at a root.
+  enum class Visit : std::uint8_t
+  {
+    kNone,
+    kOpen,
+    kDone
+  };
+  std::vector<Visit> visits(size, Visit::kNone);
+  for (auto i = 0u; i < size; i++)
+    {
+      auto current{static_cast<NodeIndex>(i)};
+      while (current != kInvalidNodeIndex && visits[current] == Visit::kNone)
+        {
+          visits[current] = Visit::kOpen;
+          current = parent_[current];
+        }
+      if (current != kInvalidNodeIndex && visits[current] == Visit::kOpen)
+        {
+          return false;
+        }
+      for (current = i;
+           current != kInvalidNodeIndex && visits[current] == Visit::kOpen;
+           current = parent_[current])
+        {
+          visits[current] = Visit::kDone;
+        }
+    }
+  return true;
+}
+
+void Tree::Unlink(const NodeIndex index)
+{
+  const auto parent{parent_[index]};
+  if (parent == kInvalidNodeIndex)
+    {
+      return;
+    }
+  if (first_child_[parent] == index)
+    {
+      first_child_[parent] = next_sibling_[index];
+      return;
+    }
+  auto sibling{first_child_[parent]};
+  while (next_sibling_[sibling] != index)
+    {
+      sibling = next_sibling_[sibling];
+    }
+  next_sibling_[sibling] = next_sibling_[index];
+}
+
+} // namespace planning
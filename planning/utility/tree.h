@@ -0,0 +1,120 @@
+/**
+ * @file tree.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Arena tree storage for tree based planners.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_TREE_H_
+#define PLANNING_INCLUDE_TREE_H_
+
+#include "data_types.h"
+#include "node_parent.h"
+
+#include <cstddef>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+namespace planning
+{
+
+using NodeIndex = std::size_t;
+constexpr NodeIndex kInvalidNodeIndex{std::numeric_limits<NodeIndex>::max()};
+
+/**
+ * @brief Tree stored as parallel arrays indexed by NodeIndex. Children of a
+ * node form a singly linked list through first child and next sibling, so
+ * reparenting a node does not allocate.
+ */
+class Tree
+{
+public:
+  /**
+   * @brief Append node as the first child of parent, kInvalidNodeIndex for a
+   * root.
+   *
+   * @return NodeIndex Index of the new node.
+   */
+  NodeIndex AddNode(const Node &node, const NodeIndex parent,
+                    const Cost &cost);
+
+  /**
+   * @brief Move node with its subtree under parent. Costs are not updated.
+   *
+   */
+  void SetParent(const NodeIndex index, const NodeIndex parent);
+
+  Node GetNode(const NodeIndex index) const
+  {
+    return Node(x_[index], y_[index]);
+  }
+  NodeIndex GetParent(const NodeIndex index) const { return parent_[index]; }
+  NodeIndex GetFirstChild(const NodeIndex index) const
+  {
+    return first_child_[index];
+  }
+  NodeIndex GetNextSibling(const NodeIndex index) const
+  {
+    return next_sibling_[index];
+  }
+  const Cost &GetCost(const NodeIndex index) const { return cost_[index]; }
+  void SetCost(const NodeIndex index, const Cost &cost)
+  {
+    cost_[index] = cost;
+  }
+
+  std::size_t Size() const { return x_.size(); }
+  bool Empty() const { return x_.empty(); }
+  std::size_t Capacity() const { return x_.capacity(); }
+  void Reserve(const std::size_t size);
+  void Clear();
+
+  /**
+   * @brief Backtrace path from index to its root.
+   *
+   */
+  Path ReconstructPath(const NodeIndex index) const;
+
+  /**
+   * @brief Copy of the tree as NodeParent graph, element i is node i.
+   *
+   */
+  std::vector<std::shared_ptr<NodeParent>> ToNodeParents() const;
+
+  /**
+   * @brief Write the arrays in binary form.
+   *
+   */
+  void Save(std::ostream &stream) const;
+
+  /**
+   * @brief Read a tree written by Save. Stream must be seekable so the size
+   * can be checked before allocating. Trees with indices out of range,
+   * broken child lists or parent cycles are rejected and the tree is cleared.
+   *
+   * @return true if the tree is read.
+   */
+  bool Load(std::istream &stream);
+
+private:
+  void Unlink(const NodeIndex index);
+  bool IsConsistent() const;
+
+  std::vector<int> x_{};
+  std::vector<int> y_{};
+  std::vector<NodeIndex> parent_{};
+  std::vector<NodeIndex> first_child_{};
+  std::vector<NodeIndex> next_sibling_{};
+  std::vector<Cost> cost_{};
+}; // class Tree
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_TREE_H_ */
@@ -0,0 +1,171 @@
+/**
+ * @file work_stealing_pool.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "work_stealing_pool.h"
+
+#include <algorithm>
+
+namespace planning
+{
+
+WorkStealingPool::WorkStealingPool(const unsigned int thread_count)
+    : thread_count_(thread_count != 0
+                        ? thread_count
+                        : std::max(1u, std::thread::hardware_concurrency()))
+{
+  for (auto i = 0u; i < thread_count_; i++)
+    {
+      ranges_.emplace_back(std::make_unique<Range>());
+    }
+  for (auto i = 1u; i < thread_count_; i++)
+    {
+      threads_.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  start_condition_.notify_all();
+  for (auto &thread : threads_)
+    {
+      thread.join();
+    }
+}
+
+void WorkStealingPool::Run(const std::size_t count, const Task &task)
+{
+  if (count == 0)
+    {
+      return;
+    }
+
+  // Workers are idle, so ranges can be set without their locks.
+  for (auto i = 0u; i < thread_count_; i++)
+    {
+      ranges_[i]->begin = count * i / thread_count_;
+      ranges_[i]->end = count * (i + 1) / thread_count_;
+    }
+  task_ = &task;
+  steal_count_ = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    busy_workers_ = thread_count_ - 1;
+    generation_++;
+  }
+  start_condition_.notify_all();
+
+  Work(0);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  done_condition_.wait(lock, [this]() { return busy_workers_ == 0; });
+  task_ = nullptr;
+}
+
+void WorkStealingPool::WorkerLoop(const unsigned int worker)
+{
+  std::uint64_t generation{0};
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true)
+    {
+      start_condition_.wait(
+          lock, [&]() { return stop_ || generation_ != generation; });
+      if (stop_)
+        {
+          return;
+        }
+      generation = generation_;
+
+      lock.unlock();
+      Work(worker);
+      lock.lock();
+
+      if (--busy_workers_ == 0)
+        {
+          done_condition_.notify_one();
+        }
+    }
+}
+
+void WorkStealingPool::Work(const unsigned int worker)
+{
+  std::size_t index;
+  do
+    {
+      while (Pop(worker, index))
+        {
+          (*task_)(index, worker);
+        }
+    }
+  while (Steal(worker));
+}
+
+bool WorkStealingPool::Pop(const unsigned int worker, std::size_t &index)
+{
+  auto &range{*ranges_[worker]};
+  std::lock_guard<std::mutex> lock(range.mutex);
+  if (range.begin == range.end)
+    {
+      return false;
+    }
+  index = range.begin++;
+  return true;
+}
+
+bool WorkStealingPool::Steal(const unsigned int worker)
+{
+  while (true)
+    {
+      // Largest range left is the one least likely to run dry meanwhile.
+      auto victim{worker};
+      std::size_t victim_size{0};
+      for (auto i = 0u; i < thread_count_; i++)
+        {
+          std::lock_guard<std::mutex> lock(ranges_[i]->mutex);
+          if (i != worker && ranges_[i]->end - ranges_[i]->begin > victim_size)
+            {
+              victim = i;
+              victim_size = ranges_[i]->end - ranges_[i]->begin;
+            }
+        }
+      if (victim == worker)
+        {
+          return false;
+        }
+
+      std::size_t begin;
+      std::size_t end;
+      {
+        auto &range{*ranges_[victim]};
+        std::lock_guard<std::mutex> lock(range.mutex);
+        if (range.begin == range.end)
+          {
+            continue;
+          }
+        end = range.end;
+        begin = end - (end - range.begin + 1) / 2;
+        range.end = begin;
+      }
+
+      // Own range is empty, other thieves skip it until it is set.
+      auto &range{*ranges_[worker]};
+      std::lock_guard<std::mutex> lock(range.mutex);
+      range.begin = begin;
+      range.end = end;
+      steal_count_ += end - begin;
+      return true;
+    }
+}
+
+} // namespace planning
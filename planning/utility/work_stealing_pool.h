@@ -0,0 +1,94 @@
+/**
+ * @file work_stealing_pool.h
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Thread pool for many independent tasks of uneven length.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PLANNING_INCLUDE_WORK_STEALING_POOL_H_
+#define PLANNING_INCLUDE_WORK_STEALING_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace planning
+{
+
+/**
+ * @brief Runs tasks 0..count-1 on a fixed set of workers. Every worker starts
+ * with an equal range of tasks and, once its range is empty, steals half of
+ * the largest range left. The calling thread is worker 0.
+ */
+class WorkStealingPool
+{
+public:
+  using Task = std::function<void(std::size_t index, unsigned int worker)>;
+
+  /**
+   * @brief Zero thread count uses every hardware thread.
+   *
+   */
+  explicit WorkStealingPool(const unsigned int thread_count = 0);
+  ~WorkStealingPool();
+
+  WorkStealingPool(const WorkStealingPool &) = delete;
+  WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+  unsigned int GetThreadCount() const { return thread_count_; }
+
+  /**
+   * @brief Run task for every index below count and wait for all of them.
+   * Only one Run may be in progress at a time.
+   *
+   */
+  void Run(const std::size_t count, const Task &task);
+
+  /**
+   * @brief Tasks taken from another worker in the last Run.
+   *
+   */
+  std::size_t GetStealCount() const { return steal_count_.load(); }
+
+private:
+  // Tasks [begin, end) not yet taken. The owner takes from begin, thieves
+  // take the upper half.
+  struct Range
+  {
+    std::mutex mutex;
+    std::size_t begin{0};
+    std::size_t end{0};
+  };
+
+  void Work(const unsigned int worker);
+  bool Pop(const unsigned int worker, std::size_t &index);
+  bool Steal(const unsigned int worker);
+  void WorkerLoop(const unsigned int worker);
+
+  unsigned int thread_count_{1};
+  std::vector<std::unique_ptr<Range>> ranges_{};
+  std::vector<std::thread> threads_{};
+  const Task *task_{nullptr};
+  std::atomic<std::size_t> steal_count_{0};
+
+  std::mutex mutex_{};
+  std::condition_variable start_condition_{};
+  std::condition_variable done_condition_{};
+  std::uint64_t generation_{0};
+  unsigned int busy_workers_{0};
+  bool stop_{false};
+}; // class WorkStealingPool
+
+} // namespace planning
+
+#endif /* PLANNING_INCLUDE_WORK_STEALING_POOL_H_ */
@@ -13,6 +13,9 @@
 #include "test_fixture.h"
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 namespace planning
 {
 
@@ -45,4 +48,73 @@ TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithAStar)
   std::cout << "Path size: " << path.size() << std::endl;
 }
 
+TEST_F(RealMapTestFixture, AStarContextsKeepSeparateLogs)
+{
+  const AStar path_finder(0.5, 4);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  auto context{path_finder.CreateContext()};
+  auto other_context{path_finder.CreateContext()};
+  Path path;
+  Path other_path;
+  std::thread other_thread([&]() {
+    other_path =
+        path_finder.FindPath(goal_node, start_node, map_, *other_context);
+  });
+  path = path_finder.FindPath(start_node, goal_node, map_, *context);
+  other_thread.join();
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  ASSERT_GT(other_path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(context->GetLog().second->node, goal_node);
+  EXPECT_EQ(other_context->GetLog().second->node, start_node);
+}
+
+TEST_F(RealMapTestFixture, AStarBatchMatchesSerialQueries)
+{
+  AStar path_finder(0.5, 4);
+  const std::vector<Query> queries{{Node(90, 185), Node(445, 336)},
+                                   {Node(445, 336), Node(90, 185)},
+                                   {Node(90, 185), Node(90, 185)},
+                                   {Node(300, 100), Node(90, 185)}};
+  auto results{path_finder.FindPaths(queries, map_, 3)};
+
+  ASSERT_EQ(results.size(), queries.size());
+  for (auto i = 0u; i < queries.size(); i++)
+    {
+      EXPECT_EQ(results[i].path, path_finder.FindPath(queries[i].first,
+                                                      queries[i].second, map_));
+      EXPECT_LT(results[i].stats.worker, 3u);
+      EXPECT_EQ(results[i].stats.planning.nodes_expanded,
+                path_finder.GetStats().nodes_expanded);
+    }
+}
+
+TEST_F(RealMapTestFixture, AStarAsyncCancelledReturnsEmptyPath)
+{
+  AStar path_finder(0.5, 4);
+  auto token{std::make_shared<CancellationToken>()};
+  token->Cancel();
+  auto future{
+      path_finder.FindPathAsync(Node(90, 185), Node(445, 336), map_, token)};
+
+  EXPECT_TRUE(future.get().empty());
+  EXPECT_TRUE(path_finder.GetLog().first.empty());
+}
+
+TEST_F(RealMapTestFixture, AStarStatsCountTheSearch)
+{
+  AStar path_finder(0.5, 4);
+  Path path = path_finder.FindPath(Node(90, 185), Node(445, 336), map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  const auto stats{path_finder.GetStats()};
+  EXPECT_EQ(stats.nodes_expanded, path_finder.GetLog().first.size());
+  EXPECT_GT(stats.nodes_generated, stats.nodes_expanded);
+  EXPECT_EQ(stats.allocations, stats.nodes_generated);
+  EXPECT_GT(stats.open_list_peak, 0u);
+  EXPECT_LE(stats.open_list_peak, stats.nodes_generated);
+  EXPECT_GT(stats.total_time.count(), 0);
+}
+
 } // namespace planning
@@ -0,0 +1,72 @@
+/**
+ * @file test_append_only_log.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utility/append_only_log.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace planning
+{
+
+TEST(AppendOnlyLogTest, ReadsOnlyNewEntriesAcrossChunks)
+{
+  AppendOnlyLog<int> log;
+  std::vector<int> entries;
+  std::size_t cursor{0};
+  for (auto i = 0; i < 10000; i++)
+    {
+      log.Append(i);
+      if (i % 777 == 0)
+        {
+          cursor = log.Read(cursor, entries);
+          EXPECT_EQ(cursor, entries.size());
+        }
+    }
+  cursor = log.Read(cursor, entries);
+  EXPECT_EQ(log.Read(cursor, entries), cursor);
+
+  ASSERT_EQ(entries.size(), 10000u);
+  for (auto i = 0; i < 10000; i++)
+    {
+      EXPECT_EQ(entries[i], i);
+    }
+}
+
+TEST(AppendOnlyLogTest, ReaderRunsWhileWriterAppends)
+{
+  constexpr auto kCount{200000};
+  AppendOnlyLog<std::size_t> log;
+  std::thread writer([&log]() {
+    for (std::size_t i = 0; i < kCount; i++)
+      {
+        log.Append(i);
+      }
+  });
+  std::vector<std::size_t> entries;
+  std::size_t cursor{0};
+  while (cursor < kCount)
+    {
+      cursor = log.Read(cursor, entries);
+    }
+  writer.join();
+
+  ASSERT_EQ(entries.size(), static_cast<std::size_t>(kCount));
+  for (std::size_t i = 0; i < kCount; i++)
+    {
+      ASSERT_EQ(entries[i], i);
+    }
+}
+
+} // namespace planning
@@ -40,4 +40,26 @@ TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithBFS)
   std::cout << "Path size: " << path.size() << std::endl;
 }
 
+TEST_F(RealMapTestFixture, BFSSteppingMatchesFindPath)
+{
+  constexpr int search_space{4};
+  BFS path_finder(search_space);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  auto context{path_finder.CreateContext()};
+  path_finder.Begin(start_node, goal_node, map_, *context);
+  auto steps{0};
+  while (path_finder.Step(100, *context) == PlanningStatus::kRunning)
+    {
+      // Log can be read between steps without another thread.
+      steps++;
+      EXPECT_LE(context->GetLog().first.size(), steps * 100u);
+    }
+
+  EXPECT_GT(steps, 1);
+  EXPECT_EQ(context->GetStatus(), PlanningStatus::kSucceeded);
+  EXPECT_EQ(context->GetPath(),
+            path_finder.FindPath(start_node, goal_node, map_));
+}
+
 } // namespace planning
@@ -0,0 +1,58 @@
+/**
+ * @file test_component_labels.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "grid_base/bfs/bfs.h"
+#include "test_fixture.h"
+#include <gtest/gtest.h>
+
+namespace planning
+{
+
+using namespace planning::grid_base;
+
+TEST_F(TestFixture, ComponentLabels_UpdatedWithMapEdits)
+{
+  constexpr int search_space{4};
+  const auto corner_node = Node(0, 0);
+  const auto goal_node = Node(7, 8);
+  map_->EnableComponentLabels(search_space);
+  EXPECT_TRUE(map_->IsReachable(corner_node, goal_node));
+
+  // Wall off the corner.
+  map_->SetNodeState(Node(0, 1), NodeState::kOccupied);
+  map_->SetNodeState(Node(1, 0), NodeState::kOccupied);
+  EXPECT_FALSE(map_->IsReachable(corner_node, goal_node));
+
+  auto path_finder = std::make_shared<BFS>(search_space);
+  Path path = path_finder->FindPath(corner_node, goal_node, map_);
+  EXPECT_EQ(path.size(), 0u) << "Path is found to an unreachable goal";
+  EXPECT_EQ(path_finder->GetLog().first.size(), 0u);
+
+  map_->SetNodeState(Node(1, 0), NodeState::kFree);
+  EXPECT_TRUE(map_->IsReachable(corner_node, goal_node));
+  path = path_finder->FindPath(corner_node, goal_node, map_);
+  EXPECT_GT(path.size(), 0u) << "Path is not found";
+}
+
+TEST_F(TestFixture, ComponentLabels_CopiesDoNotShareEdits)
+{
+  const auto corner_node = Node(0, 0);
+  const auto goal_node = Node(7, 8);
+  map_->EnableComponentLabels(4);
+  auto map_copy = std::make_shared<Map>(*map_);
+
+  map_copy->SetNodeState(Node(0, 1), NodeState::kOccupied);
+  map_copy->SetNodeState(Node(1, 0), NodeState::kOccupied);
+  EXPECT_FALSE(map_copy->IsReachable(corner_node, goal_node));
+  EXPECT_TRUE(map_->IsReachable(corner_node, goal_node));
+}
+
+} // namespace planning
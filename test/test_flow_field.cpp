@@ -0,0 +1,92 @@
+/**
+ * @file test_flow_field.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "grid_base/flow_field/flow_field.h"
+#include "test_fixture.h"
+#include <gtest/gtest.h>
+
+namespace planning
+{
+
+using namespace planning::grid_base;
+
+TEST_F(TestFixture, PathPlanning_WithFlowField)
+{
+  constexpr int search_space{4};
+  constexpr int tile_size{4};
+  FlowField flow_field(search_space, tile_size);
+  const auto start_node = Node(1, 5);
+  const auto goal_node = Node(7, 8);
+  flow_field.Compute(goal_node, map_);
+
+  flow_field.UpdateTiles({start_node});
+  EXPECT_EQ(flow_field.GetComputedTileCount(), 1u);
+
+  Path path = flow_field.FollowFlow(start_node);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(path.back(), goal_node);
+}
+
+TEST_F(RealMapTestFixture, FlowFieldUpdateOnRealMap_MatchesRecompute)
+{
+  constexpr int search_space{8};
+  constexpr int tile_size{16};
+  FlowField flow_field(search_space, tile_size);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  flow_field.Compute(goal_node, map_);
+  Path path = flow_field.FollowFlow(start_node);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  const auto compute_stats{flow_field.GetStats()};
+  EXPECT_GT(compute_stats.nodes_expanded, 0u);
+
+  auto count_mismatches = [&]() {
+    FlowField recomputed(search_space, tile_size);
+    recomputed.Compute(goal_node, map_);
+    auto mismatches{0u};
+    for (auto i = 0u; i < map_->GetHeight(); i++)
+      {
+        for (auto j = 0u; j < map_->GetWidth(); j++)
+          {
+            auto expected{recomputed.GetDistance(Node(i, j))};
+            auto actual{flow_field.GetDistance(Node(i, j))};
+            if (expected != actual && std::abs(expected - actual) > 1e-6)
+              {
+                mismatches++;
+              }
+          }
+      }
+    return mismatches;
+  };
+
+  // Block a piece of the path, then open it again.
+  std::vector<Node> changed_nodes(path.begin() + path.size() / 2 - 3,
+                                  path.begin() + path.size() / 2 + 4);
+  for (const auto &node : changed_nodes)
+    {
+      map_->SetNodeState(node, NodeState::kOccupied);
+    }
+  flow_field.UpdateCells(changed_nodes);
+  EXPECT_EQ(count_mismatches(), 0u);
+  EXPECT_GT(flow_field.FollowFlow(start_node).size(), 0u);
+  EXPECT_LT(flow_field.GetStats().nodes_expanded,
+            compute_stats.nodes_expanded);
+
+  for (const auto &node : changed_nodes)
+    {
+      map_->SetNodeState(node, NodeState::kFree);
+    }
+  flow_field.UpdateCells(changed_nodes);
+  EXPECT_EQ(count_mismatches(), 0u);
+  EXPECT_EQ(flow_field.FollowFlow(start_node).size(), path.size());
+}
+
+} // namespace planning
@@ -0,0 +1,103 @@
+/**
+ * @file test_fmt_star.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "test_fixture.h"
+#include "tree_base/fmt_star/fmt_star.h"
+
+#include <gtest/gtest.h>
+
+namespace planning
+{
+
+TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithFMTStar)
+{
+  auto path_finder{std::make_shared<tree_base::FMTStar>()};
+  path_finder->SetSeed(1);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(path.front(), start_node);
+  EXPECT_EQ(path.back(), goal_node);
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      EXPECT_FALSE(CheckIfCollisionBetweenNodes(path[i - 1], path[i], map_));
+    }
+
+  auto log{path_finder->GetLog()};
+  EXPECT_EQ(ReconstructPath(log.second), path);
+  for (const auto &node : log.first)
+    {
+      if (node->parent != nullptr)
+        {
+          EXPECT_DOUBLE_EQ(node->cost.g, node->parent->cost.g + 1);
+        }
+    }
+  const auto stats{path_finder->GetStats()};
+  EXPECT_EQ(stats.nodes_generated, log.first.size());
+  EXPECT_GT(stats.nodes_expanded, 0u);
+  EXPECT_GT(stats.neighbor_queries, stats.nodes_generated);
+  EXPECT_GT(stats.collision_time.count(), 0);
+  std::cout << "Collision checks: " << path_finder->GetCollisionCheckCount()
+            << " Tree size: " << log.first.size() << std::endl;
+}
+
+TEST_F(RealMapTestFixture, FMTStarImprovesAcrossBatches)
+{
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  tree_base::FMTStar one_batch(2000, 2000, 15);
+  one_batch.SetSeed(1);
+  ASSERT_GT(one_batch.FindPath(start_node, goal_node, map_).size(), 0u);
+  auto one_batch_log{one_batch.GetLog()};
+
+  // One check per edge attempt, far fewer than the tree has node pairs in
+  // range.
+  EXPECT_LT(one_batch.GetCollisionCheckCount(), 2 * one_batch_log.first.size());
+
+  // Same first batch, later batches can only lower the goal cost.
+  tree_base::FMTStar batches(10000, 2000, 15);
+  batches.SetSeed(1);
+  ASSERT_GT(batches.FindPath(start_node, goal_node, map_).size(), 0u);
+  auto log{batches.GetLog()};
+  EXPECT_LT(log.second->cost.f, one_batch_log.second->cost.f);
+  std::cout << "One batch cost: " << one_batch_log.second->cost.f
+            << " Five batches cost: " << log.second->cost.f << std::endl;
+}
+
+TEST_F(RealMapTestFixture, FMTStarAsyncCancelledReturnsEmptyPath)
+{
+  tree_base::FMTStar path_finder;
+  path_finder.SetSeed(1);
+  auto token{std::make_shared<CancellationToken>()};
+  token->Cancel();
+  auto future{
+      path_finder.FindPathAsync(Node(90, 185), Node(445, 336), map_, token)};
+  EXPECT_TRUE(future.get().empty());
+  EXPECT_EQ(path_finder.GetLog().first.size(), 1u);
+}
+
+TEST_F(RealMapTestFixture, FMTStarWithoutLoggingMatchesLoggedRun)
+{
+  tree_base::FMTStar logged;
+  tree_base::BasicFMTStar<NoLogging> silent;
+  logged.SetSeed(1);
+  silent.SetSeed(1);
+  Path path = logged.FindPath(Node(90, 185), Node(445, 336), map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(silent.FindPath(Node(90, 185), Node(445, 336), map_), path);
+  EXPECT_GT(logged.GetLog().first.size(), 0u);
+  EXPECT_EQ(silent.GetLog().first.size(), 0u);
+}
+
+} // namespace planning
@@ -0,0 +1,75 @@
+/**
+ * @file test_kd_tree.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utility/common_tree_base.h"
+#include "utility/kd_tree.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace planning
+{
+
+TEST(UnitTest, KDTreeMatchesLinearScan)
+{
+  std::mt19937 generator(7);
+  std::uniform_int_distribution<> coordinate(0, 511);
+  std::vector<Node> nodes;
+  KDTree kd_tree;
+  for (auto i = 0u; i < 5000; i++)
+    {
+      nodes.emplace_back(coordinate(generator), coordinate(generator));
+      kd_tree.Insert(nodes.back(), i);
+    }
+  ASSERT_EQ(kd_tree.Size(), nodes.size());
+
+  std::vector<std::size_t> ids;
+  for (auto i = 0; i < 500; i++)
+    {
+      Node query(coordinate(generator), coordinate(generator));
+      auto nearest{std::min_element(
+          nodes.begin(), nodes.end(), [&query](const Node &a, const Node &b) {
+            return EuclideanDistance(a, query) < EuclideanDistance(b, query);
+          })};
+      EXPECT_DOUBLE_EQ(EuclideanDistance(nodes[kd_tree.Nearest(query)], query),
+                       EuclideanDistance(*nearest, query));
+
+      constexpr double radius{15.0};
+      kd_tree.Radius(query, radius, ids);
+      auto expected_count{std::count_if(
+          nodes.begin(), nodes.end(), [&query](const Node &node) {
+            return EuclideanDistance(node, query) < radius;
+          })};
+      EXPECT_EQ(static_cast<long>(ids.size()), expected_count);
+      for (const auto id : ids)
+        {
+          EXPECT_LT(EuclideanDistance(nodes[id], query), radius);
+        }
+
+      constexpr std::size_t k{10};
+      std::vector<double> distances;
+      for (const auto &node : nodes)
+        {
+          distances.emplace_back(EuclideanDistance(node, query));
+        }
+      std::sort(distances.begin(), distances.end());
+      kd_tree.KNearest(query, k, ids);
+      ASSERT_EQ(ids.size(), k);
+      for (auto j = 0u; j < k; j++)
+        {
+          EXPECT_DOUBLE_EQ(EuclideanDistance(nodes[ids[j]], query),
+                           distances[j]);
+        }
+    }
+}
+
+} // namespace planning
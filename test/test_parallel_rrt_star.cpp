@@ -0,0 +1,70 @@
+/**
+ * @file test_parallel_rrt_star.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "test_fixture.h"
+#include "tree_base/parallel_rrt_star/parallel_rrt_star.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace planning
+{
+
+TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithParallelRRTStar)
+{
+  auto path_finder{
+      std::make_shared<tree_base::ParallelRRTStar>(10000, 10, 5, 15, 5, 4)};
+  path_finder->SetSeed(1);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(path.front(), start_node);
+  EXPECT_EQ(path.back(), goal_node);
+
+  // Every cost must match its parent after concurrent rewiring.
+  auto log{path_finder->GetLog()};
+  for (const auto &node : log.first)
+    {
+      if (node->parent == nullptr)
+        {
+          continue;
+        }
+      EXPECT_DOUBLE_EQ(node->cost.g, node->parent->cost.g + 1);
+      EXPECT_NEAR(node->cost.h,
+                  node->parent->cost.h +
+                      EuclideanDistance(node->node, node->parent->node),
+                  1e-6);
+    }
+  EXPECT_EQ(ReconstructPath(log.second), path);
+
+  // Stats of the workers are added up once they have joined.
+  const auto stats{path_finder->GetStats()};
+  EXPECT_EQ(stats.nodes_generated, log.first.size());
+  EXPECT_LE(stats.nodes_expanded, 10000u);
+  EXPECT_GT(stats.collision_checks, stats.nodes_generated);
+  EXPECT_GT(stats.rewire_time.count(), 0);
+}
+
+TEST_F(RealMapTestFixture, ParallelRRTStarAsyncCancelledReturnsEmptyPath)
+{
+  tree_base::ParallelRRTStar path_finder(10000, 10, 5, 15, 5, 4);
+  path_finder.SetSeed(1);
+  auto token{std::make_shared<CancellationToken>()};
+  token->Cancel();
+  auto future{
+      path_finder.FindPathAsync(Node(90, 185), Node(445, 336), map_, token)};
+  EXPECT_TRUE(future.get().empty());
+  EXPECT_EQ(path_finder.GetLog().first.size(), 1u);
+}
+
+} // namespace planning
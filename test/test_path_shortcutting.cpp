@@ -0,0 +1,72 @@
+/**
+ * @file test_path_shortcutting.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "grid_base/astar/astar.h"
+#include "test_fixture.h"
+#include "tree_base/rrt/rrt.h"
+#include "utility/path_shortcutting.h"
+#include <gtest/gtest.h>
+
+namespace planning
+{
+
+void ExpectCollisionFree(const Path &path, const std::shared_ptr<Map> map)
+{
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      EXPECT_FALSE(CheckIfCollisionBetweenNodes(path[i - 1], path[i], map))
+          << path[i - 1] << " " << path[i];
+    }
+}
+
+TEST_F(RealMapTestFixture, PathShortcutting_OnAStarPath)
+{
+  constexpr double heuristic{0.5};
+  constexpr int search_space{8};
+  auto path_finder =
+      std::make_shared<grid_base::AStar>(heuristic, search_space);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  Path greedy_path = GreedyShortcutPath(path, map_);
+  EXPECT_LT(greedy_path.size(), path.size());
+  EXPECT_LE(PathLength(greedy_path), PathLength(path));
+  EXPECT_EQ(greedy_path.front(), start_node);
+  EXPECT_EQ(greedy_path.back(), goal_node);
+  ExpectCollisionFree(greedy_path, map_);
+
+  Path random_path = RandomShortcutPath(greedy_path, map_, 200, 42);
+  EXPECT_LE(PathLength(random_path), PathLength(greedy_path));
+  EXPECT_EQ(random_path.front(), start_node);
+  EXPECT_EQ(random_path.back(), goal_node);
+  ExpectCollisionFree(random_path, map_);
+  std::cout << "Path length: " << PathLength(path) << " -> "
+            << PathLength(greedy_path) << " -> " << PathLength(random_path)
+            << std::endl;
+}
+
+TEST_F(RealMapTestFixture, PathShortcutting_OnRRTPath)
+{
+  auto path_finder = std::make_shared<tree_base::RRT>();
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  Path random_path =
+      RandomShortcutPath(GreedyShortcutPath(path, map_), map_, 200, 42);
+  EXPECT_LT(PathLength(random_path), PathLength(path));
+  ExpectCollisionFree(random_path, map_);
+}
+
+} // namespace planning
@@ -0,0 +1,213 @@
+/**
+ * @file test_prm.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "test_fixture.h"
+#include "tree_base/prm/prm.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+namespace planning
+{
+
+TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithPRM)
+{
+  auto path_finder{std::make_shared<tree_base::PRM>(2000, 10, 4)};
+  path_finder->SetSeed(1);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(path.front(), start_node);
+  EXPECT_EQ(path.back(), goal_node);
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      EXPECT_FALSE(CheckIfCollisionBetweenNodes(path[i - 1], path[i], map_));
+    }
+  EXPECT_EQ(ReconstructPath(path_finder->GetLog().second), path);
+  const auto build_stats{path_finder->GetStats()};
+  EXPECT_GT(build_stats.nodes_generated, path_finder->GetRoadmap().Size());
+  EXPECT_GT(build_stats.sampling_time.count(), 0);
+
+  // Second query reuses the roadmap.
+  const auto *roadmap_node{&path_finder->GetRoadmap().GetNode(0)};
+  EXPECT_GT(path_finder->FindPath(goal_node, start_node, map_).size(), 0u);
+  EXPECT_EQ(&path_finder->GetRoadmap().GetNode(0), roadmap_node);
+  const auto query_stats{path_finder->GetStats()};
+  EXPECT_GT(query_stats.nodes_expanded, 0u);
+  EXPECT_EQ(query_stats.sampling_time.count(), 0);
+  EXPECT_LT(query_stats.collision_checks, build_stats.collision_checks);
+}
+
+TEST_F(RealMapTestFixture, PRMRoadmapSaveAndLoad)
+{
+  const std::string file_path{"test_prm.roadmap"};
+  auto built{std::make_shared<tree_base::PRM>(1000, 8, 2)};
+  built->SetSeed(2);
+  built->BuildRoadmap(map_);
+  ASSERT_TRUE(built->SaveRoadmap(file_path));
+
+  auto loaded{std::make_shared<tree_base::PRM>(1000, 8, 2)};
+  ASSERT_TRUE(loaded->LoadRoadmap(file_path, map_));
+  const auto &roadmap{built->GetRoadmap()};
+  ASSERT_EQ(loaded->GetRoadmap().Size(), roadmap.Size());
+  ASSERT_EQ(loaded->GetRoadmap().GetEdgeCount(), roadmap.GetEdgeCount());
+  EXPECT_GT(roadmap.GetEdgeCount(), roadmap.Size());
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  EXPECT_EQ(loaded->FindPath(start_node, goal_node, map_),
+            built->FindPath(start_node, goal_node, map_));
+
+  // A roadmap is rejected for a map with other obstacles.
+  auto other_map{std::make_shared<Map>(*map_)};
+  other_map->SetNodeState(start_node, NodeState::kOccupied);
+  EXPECT_FALSE(loaded->LoadRoadmap(file_path, other_map));
+  std::remove(file_path.c_str());
+}
+
+TEST_F(RealMapTestFixture, PRMReportsRoadmapSaveFailureSilently)
+{
+  tree_base::PRM path_finder(500, 10, 4);
+  path_finder.SetSeed(1);
+  path_finder.SetRoadmapFile("/nonexistent/roadmap.bin");
+  testing::internal::CaptureStdout();
+  Path path = path_finder.FindPath(Node(90, 185), Node(445, 336), map_);
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+  EXPECT_GT(path.size(), 0u);
+  EXPECT_TRUE(path_finder.HasRoadmapSaveFailed());
+
+  // A reused roadmap is not saved again.
+  path_finder.FindPath(Node(445, 336), Node(90, 185), map_);
+  EXPECT_FALSE(path_finder.HasRoadmapSaveFailed());
+}
+
+TEST_F(RealMapTestFixture, RoadmapLoadRejectsCorruptFiles)
+{
+  Roadmap roadmap;
+  roadmap.Build({Node(1, 1), Node(2, 2), Node(3, 3)}, {{0, 1}, {1, 2}});
+  std::stringstream stream;
+  roadmap.Save(stream, *map_);
+  const auto bytes{stream.str()};
+  const auto version_offset{sizeof(std::uint32_t)};
+  const auto node_count_offset{2 * sizeof(std::uint32_t) +
+                               3 * sizeof(std::uint64_t)};
+  const auto node_offset{node_count_offset + 2 * sizeof(std::uint64_t)};
+  const auto edge_offset{node_offset + 3 * 2 * sizeof(std::int32_t)};
+  const auto state_offset{edge_offset + 2 * sizeof(RoadmapIndex)};
+  Roadmap loaded;
+  std::stringstream valid_stream(bytes);
+  ASSERT_TRUE(loaded.Load(valid_stream, *map_));
+  EXPECT_EQ(loaded.GetEdgeCount(), 2u);
+
+  auto other_version{bytes};
+  other_version[version_offset]++;
+  std::stringstream version_stream(other_version);
+  EXPECT_FALSE(loaded.Load(version_stream, *map_));
+
+  auto huge_count{bytes};
+  const std::uint64_t node_count{std::uint64_t{1} << 40};
+  huge_count.replace(node_count_offset, sizeof(node_count),
+                     reinterpret_cast<const char *>(&node_count),
+                     sizeof(node_count));
+  std::stringstream count_stream(huge_count);
+  EXPECT_FALSE(loaded.Load(count_stream, *map_));
+
+  auto bad_state{bytes};
+  bad_state[state_offset] = 7;
+  std::stringstream state_stream(bad_state);
+  EXPECT_FALSE(loaded.Load(state_stream, *map_));
+
+  // Nodes off the map and self loops are rejected.
+  for (const auto coordinate :
+       {static_cast<std::int32_t>(map_->GetHeight()), std::int32_t{-1}})
+    {
+      auto off_map{bytes};
+      off_map.replace(node_offset, sizeof(coordinate),
+                      reinterpret_cast<const char *>(&coordinate),
+                      sizeof(coordinate));
+      std::stringstream node_stream(off_map);
+      EXPECT_FALSE(loaded.Load(node_stream, *map_));
+    }
+  auto off_width{bytes};
+  const auto width{static_cast<std::int32_t>(map_->GetWidth())};
+  off_width.replace(node_offset + sizeof(width), sizeof(width),
+                    reinterpret_cast<const char *>(&width), sizeof(width));
+  std::stringstream width_stream(off_width);
+  EXPECT_FALSE(loaded.Load(width_stream, *map_));
+
+  auto self_loop{bytes};
+  const RoadmapIndex first{0};
+  self_loop.replace(edge_offset + sizeof(first), sizeof(first),
+                    reinterpret_cast<const char *>(&first), sizeof(first));
+  std::stringstream loop_stream(self_loop);
+  EXPECT_FALSE(loaded.Load(loop_stream, *map_));
+  EXPECT_TRUE(loaded.Empty());
+}
+
+TEST_F(RealMapTestFixture, LazyPRMChecksOnlySearchedEdges)
+{
+  auto path_finder{std::make_shared<tree_base::PRM>(2000, 10, 4)};
+  path_finder->SetSeed(1);
+  path_finder->SetLazy(true);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      EXPECT_FALSE(CheckIfCollisionBetweenNodes(path[i - 1], path[i], map_));
+    }
+  const auto &roadmap{path_finder->GetRoadmap()};
+  EXPECT_GT(roadmap.CountEdges(EdgeState::kInvalid), 0u);
+  EXPECT_LT(roadmap.CountEdges(EdgeState::kValid) +
+                roadmap.CountEdges(EdgeState::kInvalid),
+            roadmap.GetEdgeCount() / 10);
+}
+
+TEST_F(RealMapTestFixture, PRMAsyncCancelledKeepsRoadmap)
+{
+  tree_base::PRM path_finder(2000, 10, 4);
+  path_finder.SetSeed(1);
+  auto token{std::make_shared<CancellationToken>()};
+  token->Cancel();
+  auto future{
+      path_finder.FindPathAsync(Node(90, 185), Node(445, 336), map_, token)};
+  EXPECT_TRUE(future.get().empty());
+
+  // The roadmap was finished and serves the next query.
+  const auto size{path_finder.GetRoadmap().Size()};
+  EXPECT_GT(size, 0u);
+  EXPECT_GT(path_finder.FindPath(Node(90, 185), Node(445, 336), map_).size(),
+            0u);
+  EXPECT_EQ(path_finder.GetRoadmap().Size(), size);
+}
+
+TEST_F(RealMapTestFixture, PRMWithoutLoggingMatchesLoggedRun)
+{
+  tree_base::PRM logged(2000, 10, 4);
+  tree_base::BasicPRM<NoLogging> silent(2000, 10, 4);
+  logged.SetSeed(1);
+  silent.SetSeed(1);
+  Path path = logged.FindPath(Node(90, 185), Node(445, 336), map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(silent.FindPath(Node(90, 185), Node(445, 336), map_), path);
+  EXPECT_GT(logged.GetLog().first.size(), 0u);
+  EXPECT_EQ(silent.GetLog().first.size(), 0u);
+}
+
+} // namespace planning
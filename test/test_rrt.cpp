@@ -28,4 +28,21 @@ TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithRRTStar)
   std::cout << "Path size: " << path.size() << std::endl;
 }
 
+TEST_F(RealMapTestFixture, RRTSteppingMatchesFindPath)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRT>()};
+  path_finder->SetSeed(3);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  auto context{path_finder->CreateContext()};
+  path_finder->Begin(start_node, goal_node, map_, *context);
+  while (path_finder->Step(10, *context) == PlanningStatus::kRunning)
+    {
+    }
+
+  ASSERT_EQ(context->GetStatus(), PlanningStatus::kSucceeded);
+  EXPECT_EQ(context->GetPath(),
+            path_finder->FindPath(start_node, goal_node, map_));
+}
+
 } // namespace planning
@@ -0,0 +1,79 @@
+/**
+ * @file test_rrt_connect.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "test_fixture.h"
+#include "tree_base/rrt_connect/rrt_connect.h"
+
+#include <gtest/gtest.h>
+
+namespace planning
+{
+
+TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithRRTConnect)
+{
+  auto path_finder{std::make_shared<tree_base::RRTConnect>()};
+  path_finder->SetSeed(1);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(path.front(), start_node);
+  EXPECT_EQ(path.back(), goal_node);
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      EXPECT_FALSE(CheckIfCollisionBetweenNodes(path[i - 1], path[i], map_));
+    }
+
+  auto log{path_finder->GetLog()};
+  ASSERT_NE(log.second, nullptr);
+  EXPECT_EQ(ReconstructPath(log.second), path);
+}
+
+TEST_F(TestFixture, RRTConnectRejectsUnreachableGoal)
+{
+  map_->EnableComponentLabels(8);
+  map_->SetNodeState(Node(0, 1), NodeState::kOccupied);
+  map_->SetNodeState(Node(1, 0), NodeState::kOccupied);
+  auto path_finder{std::make_shared<tree_base::RRTConnect>(100, 3, 1)};
+  Path path = path_finder->FindPath(Node(0, 0), Node(7, 8), map_);
+
+  EXPECT_TRUE(path.empty());
+  EXPECT_TRUE(path_finder->GetLog().first.empty());
+}
+
+TEST_F(RealMapTestFixture, RRTConnectAsyncCancelledReturnsEmptyPath)
+{
+  tree_base::RRTConnect path_finder;
+  path_finder.SetSeed(1);
+  auto token{std::make_shared<CancellationToken>()};
+  token->Cancel();
+  auto future{
+      path_finder.FindPathAsync(Node(90, 185), Node(445, 336), map_, token)};
+  EXPECT_TRUE(future.get().empty());
+  EXPECT_EQ(path_finder.GetStats().nodes_expanded, 0u);
+}
+
+TEST_F(RealMapTestFixture, RRTConnectWithoutLoggingMatchesLoggedRun)
+{
+  tree_base::RRTConnect logged;
+  tree_base::BasicRRTConnect<NoLogging> silent;
+  logged.SetSeed(1);
+  silent.SetSeed(1);
+  Path path = logged.FindPath(Node(90, 185), Node(445, 336), map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(silent.FindPath(Node(90, 185), Node(445, 336), map_), path);
+  EXPECT_GT(logged.GetLog().first.size(), 0u);
+  EXPECT_EQ(silent.GetLog().first.size(), 0u);
+}
+
+} // namespace planning
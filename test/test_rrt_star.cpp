@@ -13,6 +13,10 @@
 #include "tree_base/rrt_star/rrt_star.h"
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+#include <vector>
+
 namespace planning
 {
 
@@ -28,4 +32,240 @@ TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithRRTStar)
   std::cout << "Path size: " << path.size() << std::endl;
 }
 
+TEST_F(RealMapTestFixture, RRTStarLogsCostsOfRewiredDescendants)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRTStar>()};
+  path_finder->SetSeed(3);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  // Every cost must match its parent after rewiring.
+  auto log{path_finder->GetLog()};
+  for (const auto &node : log.first)
+    {
+      if (node->parent == nullptr)
+        {
+          continue;
+        }
+      EXPECT_DOUBLE_EQ(node->cost.g, node->parent->cost.g + 1);
+      EXPECT_NEAR(node->cost.h,
+                  node->parent->cost.h +
+                      EuclideanDistance(node->node, node->parent->node),
+                  1e-6);
+    }
+  EXPECT_EQ(ReconstructPath(log.second), path);
+}
+
+TEST_F(RealMapTestFixture, InformedRRTStarConvergesFaster)
+{
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  auto total_cost{0.0};
+  auto total_informed_cost{0.0};
+  for (auto seed = 1u; seed <= 3; seed++)
+    {
+      auto path_finder{std::make_shared<planning::tree_base::RRTStar>()};
+      auto informed{std::make_shared<planning::tree_base::RRTStar>()};
+      path_finder->SetSeed(seed);
+      informed->SetSeed(seed);
+      informed->SetInformed(true);
+      Path path = path_finder->FindPath(start_node, goal_node, map_);
+      Path informed_path = informed->FindPath(start_node, goal_node, map_);
+
+      ASSERT_GT(path.size(), 0u) << "Path is not found";
+      ASSERT_GT(informed_path.size(), 0u) << "Path is not found";
+      // h is the path length. Informed paths have shorter edges, so more of
+      // them, and their g does not compare.
+      total_cost += path_finder->GetLog().second->cost.h;
+      total_informed_cost += informed->GetLog().second->cost.h;
+    }
+  EXPECT_LT(total_informed_cost, total_cost);
+}
+
+TEST_F(RealMapTestFixture, RRTStarLazyCollisionCheckingCastsFewerRays)
+{
+  auto eager{std::make_shared<planning::tree_base::RRTStar>()};
+  auto lazy{std::make_shared<planning::tree_base::RRTStar>()};
+  eager->SetSeed(1);
+  lazy->SetSeed(1);
+  lazy->SetLazyCollisionChecking(true);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  eager->FindPath(start_node, goal_node, map_);
+  Path path = lazy->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      EXPECT_FALSE(CheckIfCollisionBetweenNodes(path[i - 1], path[i], map_));
+    }
+  // Rewires off the goal path are never cast.
+  EXPECT_LT(lazy->GetCollisionCheckCount() * 2,
+            eager->GetCollisionCheckCount());
+  EXPECT_EQ(ReconstructPath(lazy->GetLog().second), path);
+}
+
+TEST_F(RealMapTestFixture, RRTStarStopsWhenCostStalls)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRTStar>()};
+  path_finder->SetSeed(1);
+  path_finder->SetGoalBias(0.05);
+  TerminationCondition termination;
+  termination.SetStallLimit(500, std::chrono::milliseconds(0));
+  path_finder->SetTerminationCondition(termination);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(path.back(), goal_node);
+  EXPECT_LT(path_finder->GetLog().first.size(), 10000u);
+}
+
+TEST_F(RealMapTestFixture, RRTStarConcurrentQueriesMatchSerialRuns)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRTStar>()};
+  path_finder->SetSeed(3);
+  const auto start_node = Node(90, 185);
+  const std::vector<Node> goal_nodes{Node(445, 336), Node(300, 100)};
+  std::vector<Path> serial_paths;
+  for (const auto &goal_node : goal_nodes)
+    {
+      serial_paths.push_back(
+          path_finder->FindPath(start_node, goal_node, map_));
+    }
+  ASSERT_GT(serial_paths.front().size(), 0u) << "Path is not found";
+
+  // One planner, one context per thread.
+  std::vector<Path> paths(goal_nodes.size());
+  std::vector<std::thread> threads;
+  for (auto i = 0u; i < goal_nodes.size(); i++)
+    {
+      threads.emplace_back([&, i]() {
+        auto context{path_finder->CreateContext()};
+        paths[i] =
+            path_finder->FindPath(start_node, goal_nodes[i], map_, *context);
+      });
+    }
+  for (auto &thread : threads)
+    {
+      thread.join();
+    }
+
+  EXPECT_EQ(paths, serial_paths);
+}
+
+TEST_F(RealMapTestFixture, RRTStarAsyncStopsAtDeadlineOrCancel)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRTStar>(
+      1000000, 10, 5, 15, 5)};
+  path_finder->SetSeed(3);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+
+  // Whether a path exists by the deadline depends on the machine, only the
+  // prompt return is checked.
+  auto start_time{std::chrono::steady_clock::now()};
+  path_finder
+      ->FindPathAsync(start_node, goal_node, map_, nullptr,
+                      start_time + std::chrono::milliseconds(200))
+      .get();
+  EXPECT_LT(std::chrono::steady_clock::now() - start_time,
+            std::chrono::seconds(2));
+
+  auto token{std::make_shared<CancellationToken>()};
+  start_time = std::chrono::steady_clock::now();
+  auto future{path_finder->FindPathAsync(start_node, goal_node, map_, token)};
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  token->Cancel();
+  future.get();
+  EXPECT_LT(std::chrono::steady_clock::now() - start_time,
+            std::chrono::seconds(2));
+}
+
+TEST_F(RealMapTestFixture, RRTStarCancelReturnsBestPathSoFar)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRTStar>(
+      1000000, 10, 5, 15, 5)};
+  path_finder->SetSeed(3);
+  auto token{std::make_shared<CancellationToken>()};
+  auto context{path_finder->CreateContext()};
+  context->SetStopConditions(token,
+                             std::chrono::steady_clock::time_point::max());
+  path_finder->Begin(Node(90, 185), Node(445, 336), map_, *context);
+  while (context->GetLog().second == nullptr)
+    {
+      ASSERT_EQ(path_finder->Step(500, *context), PlanningStatus::kRunning);
+    }
+
+  token->Cancel();
+  EXPECT_EQ(path_finder->Step(500, *context), PlanningStatus::kSucceeded);
+  EXPECT_EQ(context->GetPath(), ReconstructPath(context->GetLog().second));
+}
+
+TEST_F(RealMapTestFixture, RRTStarIncrementalLogMatchesFullLog)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRTStar>()};
+  path_finder->SetSeed(3);
+  auto context{path_finder->CreateContext()};
+  path_finder->Begin(Node(90, 185), Node(445, 336), map_, *context);
+  LogCursor cursor;
+  Log log;
+  while (path_finder->Step(500, *context) == PlanningStatus::kRunning)
+    {
+      context->ReadLog(cursor, log);
+    }
+  context->ReadLog(cursor, log);
+
+  // Replayed rewires give the same parents as the final tree.
+  auto full_log{context->GetLog()};
+  ASSERT_NE(log.second, nullptr);
+  ASSERT_EQ(log.first.size(), full_log.first.size());
+  for (auto i = 1u; i < log.first.size(); i++)
+    {
+      EXPECT_EQ(log.first[i]->parent->node, full_log.first[i]->parent->node);
+    }
+  EXPECT_EQ(ReconstructPath(log.second), context->GetPath());
+}
+
+TEST_F(RealMapTestFixture, RRTStarWithoutLoggingMatchesLoggedRun)
+{
+  auto logged{std::make_shared<planning::tree_base::RRTStar>()};
+  auto silent{std::make_shared<
+      planning::tree_base::BasicRRTStar<planning::NoLogging>>()};
+  logged->SetSeed(3);
+  silent->SetSeed(3);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path logged_path = logged->FindPath(start_node, goal_node, map_);
+  Path silent_path = silent->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(logged_path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(logged_path, silent_path);
+  EXPECT_GT(logged->GetLog().first.size(), 0u);
+  EXPECT_EQ(silent->GetLog().first.size(), 0u);
+}
+
+TEST_F(RealMapTestFixture, RRTStarStatsAreSilentAndConsistent)
+{
+  auto path_finder{std::make_shared<planning::tree_base::RRTStar>()};
+  path_finder->SetSeed(3);
+  testing::internal::CaptureStdout();
+  Path path = path_finder->FindPath(Node(90, 185), Node(445, 336), map_);
+  EXPECT_EQ(testing::internal::GetCapturedStdout(), "");
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  const auto stats{path_finder->GetStats()};
+  EXPECT_EQ(stats.nodes_generated, path_finder->GetLog().first.size());
+  EXPECT_EQ(stats.neighbor_queries, stats.nodes_expanded);
+  EXPECT_EQ(stats.collision_checks, path_finder->GetCollisionCheckCount());
+  EXPECT_GT(stats.sampling_time.count(), 0);
+  EXPECT_GT(stats.collision_time.count(), 0);
+  EXPECT_LE(stats.sampling_time + stats.nearest_neighbor_time +
+                stats.collision_time + stats.rewire_time,
+            stats.total_time);
+}
+
 } // namespace planning
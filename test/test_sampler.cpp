@@ -0,0 +1,100 @@
+/**
+ * @file test_sampler.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "test_fixture.h"
+#include "tree_base/fmt_star/fmt_star.h"
+#include "tree_base/parallel_rrt_star/parallel_rrt_star.h"
+#include "tree_base/prm/prm.h"
+#include "tree_base/rrt/rrt.h"
+#include "tree_base/rrt_connect/rrt_connect.h"
+#include "tree_base/rrt_star/rrt_star.h"
+#include "utility/sampler.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace planning
+{
+
+TEST_F(RealMapTestFixture, SamplerReturnsFreeNodesReproducibly)
+{
+  Sampler sampler(42);
+  Sampler same_seed_sampler(42);
+  sampler.SetMap(map_);
+  same_seed_sampler.SetMap(map_);
+  ASSERT_GT(sampler.GetFreeNodeCount(), 0u);
+
+  for (auto i = 0; i < 10000; i++)
+    {
+      auto node{sampler.FreeNode()};
+      auto same_seed_node{same_seed_sampler.FreeNode()};
+      EXPECT_EQ(map_->GetNodeState(node), NodeState::kFree);
+      EXPECT_EQ(node, same_seed_node);
+    }
+}
+
+TEST_F(RealMapTestFixture, RRTIsReproducibleFromSeed)
+{
+  auto path_finder{std::make_shared<tree_base::RRT>()};
+  path_finder->SetSeed(7);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  auto path{path_finder->FindPath(start_node, goal_node, map_)};
+  auto tree_size{path_finder->GetLog().first.size()};
+  auto same_seed_path{path_finder->FindPath(start_node, goal_node, map_)};
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(path, same_seed_path);
+  EXPECT_EQ(tree_size, path_finder->GetLog().first.size());
+}
+
+TEST_F(RealMapTestFixture, SamplerSharesFreeNodesOfMap)
+{
+  Sampler sampler(42);
+  sampler.SetMap(map_);
+  auto free_nodes{map_->GetFreeNodes()};
+  EXPECT_EQ(free_nodes, map_->GetFreeNodes());
+  EXPECT_EQ(sampler.GetFreeNodeCount(), free_nodes->size());
+
+  // Copies share the index until a cell stops being free.
+  auto copy{std::make_shared<Map>(*map_)};
+  EXPECT_EQ(copy->GetFreeNodes(), free_nodes);
+  copy->SetNodeState(free_nodes->front(), NodeState::kVisited);
+  EXPECT_EQ(copy->GetFreeNodes()->size(), free_nodes->size() - 1);
+  EXPECT_EQ(map_->GetFreeNodes(), free_nodes);
+}
+
+TEST(UnitTest, PlannersFailOnMapWithoutFreeCells)
+{
+  auto map{std::make_shared<Map>(20, 20)};
+  Sampler sampler(1);
+  sampler.SetMap(map);
+  EXPECT_EQ(sampler.GetFreeNodeCount(), 0u);
+  std::vector<Node> nodes(3);
+  sampler.FreeNodes(3, nodes);
+  EXPECT_TRUE(nodes.empty());
+
+  const auto start_node = Node(2, 2);
+  const auto goal_node = Node(17, 17);
+  std::vector<std::shared_ptr<IPlanning>> planners{
+      std::make_shared<tree_base::RRT>(),
+      std::make_shared<tree_base::RRTStar>(),
+      std::make_shared<tree_base::RRTConnect>(),
+      std::make_shared<tree_base::ParallelRRTStar>(),
+      std::make_shared<tree_base::FMTStar>(),
+      std::make_shared<tree_base::PRM>()};
+  for (const auto &planner : planners)
+    {
+      EXPECT_TRUE(planner->FindPath(start_node, goal_node, map).empty());
+    }
+}
+
+} // namespace planning
@@ -0,0 +1,137 @@
+/**
+ * @file test_search_trace.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "grid_base/astar/astar.h"
+#include "test_fixture.h"
+#include "tree_base/fmt_star/fmt_star.h"
+#include "tree_base/rrt_star/rrt_star.h"
+#include "utility/search_trace.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <set>
+#include <sstream>
+
+namespace planning
+{
+
+TEST_F(RealMapTestFixture, AStarTraceReplaysExpansionsAndPath)
+{
+  auto path_finder{std::make_shared<grid_base::AStar>(0.5, 4)};
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  std::stringstream stream;
+  {
+    SearchTraceWriter writer(stream, "astar", *map_);
+    LogCursor cursor;
+    path_finder->ReadTrace(cursor, writer);
+    writer.AddPath(path);
+  }
+  SearchTrace trace;
+  ASSERT_TRUE(ReadSearchTrace(stream, trace));
+  EXPECT_EQ(trace.planner_name, "astar");
+  EXPECT_EQ(trace.path, path);
+
+  const auto log{path_finder->GetLog()};
+  ASSERT_EQ(trace.events.size(), log.first.size());
+  for (auto i = 0u; i < log.first.size(); i++)
+    {
+      EXPECT_EQ(trace.events[i].node, log.first[i]->node);
+    }
+  // Deltas of neighbouring expansions fit in a few bytes.
+  EXPECT_LT(stream.str().size(), 6 * log.first.size() + 6 * path.size() + 64);
+}
+
+TEST_F(RealMapTestFixture, RRTStarTraceReplaysRewiredTree)
+{
+  auto path_finder{std::make_shared<tree_base::RRTStar>()};
+  path_finder->SetSeed(3);
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  std::stringstream stream;
+  {
+    SearchTraceWriter writer(stream, "rrt_star", *map_);
+    LogCursor cursor;
+    path_finder->ReadTrace(cursor, writer);
+    writer.AddPath(path);
+  }
+  SearchTrace trace;
+  ASSERT_TRUE(ReadSearchTrace(stream, trace));
+  auto rewires{0u};
+  for (const auto &event : trace.events)
+    {
+      rewires += event.type == TraceEventType::kRewire;
+    }
+  EXPECT_GT(rewires, 0u);
+
+  LogCursor cursor;
+  Log replayed;
+  ReplaySearchTrace(trace, trace.events.size(), cursor, replayed);
+  const auto log{path_finder->GetLog()};
+  ASSERT_EQ(replayed.first.size(), log.first.size());
+  for (auto i = 0u; i < log.first.size(); i++)
+    {
+      EXPECT_EQ(replayed.first[i]->node, log.first[i]->node);
+      ASSERT_EQ(replayed.first[i]->parent == nullptr,
+                log.first[i]->parent == nullptr);
+      if (log.first[i]->parent != nullptr)
+        {
+          EXPECT_EQ(replayed.first[i]->parent->node,
+                    log.first[i]->parent->node);
+        }
+    }
+  EXPECT_EQ(ReconstructPath(replayed.second), path);
+}
+
+TEST_F(RealMapTestFixture, FMTStarLogTraceReplaysFinalTree)
+{
+  tree_base::FMTStar path_finder;
+  path_finder.SetSeed(1);
+  Path path = path_finder.FindPath(Node(90, 185), Node(445, 336), map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  const auto log{path_finder.GetLog()};
+  std::stringstream stream;
+  {
+    SearchTraceWriter writer(stream, "fmt_star", *map_);
+    WriteLogTrace(log, writer);
+    writer.AddPath(path);
+  }
+  SearchTrace trace;
+  ASSERT_TRUE(ReadSearchTrace(stream, trace));
+  LogCursor cursor;
+  Log replayed;
+  ReplaySearchTrace(trace, trace.events.size(), cursor, replayed);
+
+  // Rewired nodes come after their parents, the edges stay the same.
+  using Edge = std::array<int, 4>;
+  auto edges{[](const Log &edge_log) {
+    std::multiset<Edge> result;
+    for (const auto &node : edge_log.first)
+      {
+        const auto parent{node->parent != nullptr ? node->parent->node
+                                                  : Node(-1, -1)};
+        result.insert({parent.x_, parent.y_, node->node.x_, node->node.y_});
+      }
+    return result;
+  }};
+  EXPECT_EQ(edges(replayed), edges(log));
+  EXPECT_EQ(ReconstructPath(replayed.second), path);
+}
+
+} // namespace planning
@@ -0,0 +1,60 @@
+/**
+ * @file test_spatial_hash_grid.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utility/common_tree_base.h"
+#include "utility/spatial_hash_grid.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <random>
+
+namespace planning
+{
+
+TEST(UnitTest, SpatialHashGridMatchesLinearScan)
+{
+  constexpr double radius{15.0};
+  std::mt19937 generator(11);
+  std::uniform_int_distribution<> coordinate(0, 511);
+  std::vector<Node> nodes;
+  SpatialHashGrid spatial_hash_grid(radius, 512, 512);
+  for (auto i = 0u; i < 5000; i++)
+    {
+      nodes.emplace_back(coordinate(generator), coordinate(generator));
+      spatial_hash_grid.Insert(nodes.back(), i);
+    }
+  // Every second point is removed again.
+  for (auto i = 0u; i < nodes.size(); i += 2)
+    {
+      spatial_hash_grid.Remove(nodes[i], i);
+    }
+  ASSERT_EQ(spatial_hash_grid.Size(), nodes.size() / 2);
+
+  std::vector<std::size_t> ids;
+  for (auto i = 0; i < 500; i++)
+    {
+      Node query(coordinate(generator), coordinate(generator));
+      spatial_hash_grid.Radius(query, radius, ids);
+      auto expected_count{0};
+      for (auto j = 1u; j < nodes.size(); j += 2)
+        {
+          expected_count += EuclideanDistance(nodes[j], query) < radius;
+        }
+      EXPECT_EQ(static_cast<int>(ids.size()), expected_count);
+      for (const auto id : ids)
+        {
+          EXPECT_EQ(id % 2, 1u);
+          EXPECT_LT(EuclideanDistance(nodes[id], query), radius);
+        }
+    }
+}
+
+} // namespace planning
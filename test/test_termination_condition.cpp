@@ -0,0 +1,76 @@
+/**
+ * @file test_termination_condition.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utility/termination_condition.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <limits>
+#include <thread>
+
+namespace planning
+{
+
+TEST(TerminationConditionTest, CostRules)
+{
+  constexpr auto kNoPath{std::numeric_limits<double>::infinity()};
+  TerminationCondition never;
+  never.Start();
+  for (auto i = 0; i < 100; i++)
+    {
+      EXPECT_FALSE(never.ShouldStop(i < 50 ? kNoPath : 10.0));
+    }
+
+  TerminationCondition target;
+  target.SetTargetCost(5.0);
+  target.Start();
+  EXPECT_FALSE(target.ShouldStop(kNoPath));
+  EXPECT_FALSE(target.ShouldStop(6.0));
+  EXPECT_TRUE(target.ShouldStop(5.0));
+
+  // Stall counting starts with the first path and restarts on improvement.
+  TerminationCondition stall;
+  stall.SetStallLimit(3, std::chrono::milliseconds(0));
+  stall.Start();
+  for (auto i = 0; i < 10; i++)
+    {
+      EXPECT_FALSE(stall.ShouldStop(kNoPath));
+    }
+  EXPECT_FALSE(stall.ShouldStop(10.0));
+  EXPECT_FALSE(stall.ShouldStop(10.0));
+  EXPECT_FALSE(stall.ShouldStop(10.0));
+  EXPECT_FALSE(stall.ShouldStop(9.0));
+  EXPECT_FALSE(stall.ShouldStop(9.0));
+  EXPECT_FALSE(stall.ShouldStop(9.0));
+  EXPECT_TRUE(stall.ShouldStop(9.0));
+}
+
+TEST(TerminationConditionTest, TimeRules)
+{
+  TerminationCondition budget;
+  budget.SetTimeBudget(std::chrono::milliseconds(20));
+  budget.Start();
+  EXPECT_FALSE(budget.ShouldStop(10.0));
+  std::this_thread::sleep_for(std::chrono::milliseconds(25));
+  EXPECT_TRUE(budget.ShouldStop(1.0));
+
+  TerminationCondition stall;
+  stall.SetStallLimit(0, std::chrono::milliseconds(20));
+  stall.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(25));
+  EXPECT_FALSE(stall.ShouldStop(std::numeric_limits<double>::infinity()));
+  EXPECT_FALSE(stall.ShouldStop(10.0));
+  std::this_thread::sleep_for(std::chrono::milliseconds(25));
+  EXPECT_TRUE(stall.ShouldStop(10.0));
+}
+
+} // namespace planning
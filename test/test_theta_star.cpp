@@ -0,0 +1,94 @@
+/**
+ * @file test_theta_star.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "grid_base/theta_star/theta_star.h"
+#include "test_fixture.h"
+#include <gtest/gtest.h>
+
+namespace planning
+{
+
+using namespace planning::grid_base;
+
+TEST_F(TestFixture, PathPlanning_WithThetaStar)
+{
+  constexpr double heuristic{0.5};
+  constexpr int search_space{8};
+  auto path_finder =
+      std::make_shared<ThetaStar>(heuristic, search_space, false);
+  const auto start_node = Node(1, 5);
+  const auto goal_node = Node(7, 8);
+  Path path = path_finder->FindPath(start_node, goal_node, map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      EXPECT_FALSE(CheckIfCollisionBetweenNodes(path[i - 1], path[i], map_));
+    }
+}
+
+TEST_F(RealMapTestFixture, PathPlanningOnRealMap_WithLazyThetaStar)
+{
+  constexpr double heuristic{0.5};
+  constexpr int search_space{8};
+  const auto start_node = Node(90, 185);
+  const auto goal_node = Node(445, 336);
+
+  auto theta_star =
+      std::make_shared<ThetaStar>(heuristic, search_space, false);
+  Path path = theta_star->FindPath(start_node, goal_node, map_);
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+
+  auto lazy_theta_star =
+      std::make_shared<ThetaStar>(heuristic, search_space, true);
+  Path lazy_path = lazy_theta_star->FindPath(start_node, goal_node, map_);
+  ASSERT_GT(lazy_path.size(), 0u) << "Path is not found";
+  for (auto i = 1u; i < lazy_path.size(); i++)
+    {
+      EXPECT_FALSE(
+          CheckIfCollisionBetweenNodes(lazy_path[i - 1], lazy_path[i], map_));
+    }
+
+  EXPECT_LT(lazy_theta_star->GetLineOfSightCheckCount(),
+            theta_star->GetLineOfSightCheckCount());
+  std::cout << "Theta* LOS checks: " << theta_star->GetLineOfSightCheckCount()
+            << std::endl;
+  std::cout << "Lazy Theta* LOS checks: "
+            << lazy_theta_star->GetLineOfSightCheckCount() << std::endl;
+}
+
+TEST_F(RealMapTestFixture, ThetaStarAsyncCancelledReturnsEmptyPath)
+{
+  ThetaStar path_finder(0.5, 8, false);
+  auto token{std::make_shared<CancellationToken>()};
+  token->Cancel();
+  auto future{
+      path_finder.FindPathAsync(Node(90, 185), Node(445, 336), map_, token)};
+  EXPECT_TRUE(future.get().empty());
+
+  // The token only applies to its own query.
+  EXPECT_GT(path_finder.FindPath(Node(90, 185), Node(445, 336), map_).size(),
+            0u);
+}
+
+TEST_F(RealMapTestFixture, ThetaStarWithoutLoggingMatchesLoggedRun)
+{
+  ThetaStar logged(0.5, 8, false);
+  BasicThetaStar<NoLogging> silent(0.5, 8, false);
+  Path path = logged.FindPath(Node(90, 185), Node(445, 336), map_);
+
+  ASSERT_GT(path.size(), 0u) << "Path is not found";
+  EXPECT_EQ(silent.FindPath(Node(90, 185), Node(445, 336), map_), path);
+  EXPECT_GT(logged.GetLog().first.size(), 0u);
+  EXPECT_EQ(silent.GetLog().first.size(), 0u);
+}
+
+} // namespace planning
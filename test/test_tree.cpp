@@ -0,0 +1,181 @@
+/**
+ * @file test_tree.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utility/common_planning.h"
+#include "utility/concurrent_tree.h"
+#include "utility/tree.h"
+
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace planning
+{
+
+TEST(UnitTest, TreeReparentsAndReconstructsPath)
+{
+  Tree tree;
+  auto root{tree.AddNode(Node(0, 0), kInvalidNodeIndex, Cost{})};
+  auto a{tree.AddNode(Node(0, 5), root, Cost(1, 5))};
+  auto b{tree.AddNode(Node(5, 0), root, Cost(1, 5))};
+  auto c{tree.AddNode(Node(5, 5), a, Cost(2, 10))};
+
+  EXPECT_EQ(tree.GetFirstChild(root), b);
+  EXPECT_EQ(tree.GetNextSibling(b), a);
+  EXPECT_EQ(tree.ReconstructPath(c),
+            Path({Node(0, 0), Node(0, 5), Node(5, 5)}));
+
+  tree.SetParent(a, b);
+  EXPECT_EQ(tree.GetFirstChild(root), b);
+  EXPECT_EQ(tree.GetNextSibling(b), kInvalidNodeIndex);
+  EXPECT_EQ(tree.GetFirstChild(b), a);
+  EXPECT_EQ(tree.ReconstructPath(c),
+            Path({Node(0, 0), Node(5, 0), Node(0, 5), Node(5, 5)}));
+
+  auto nodes{tree.ToNodeParents()};
+  ASSERT_EQ(nodes.size(), tree.Size());
+  EXPECT_EQ(nodes[c]->parent, nodes[a]);
+  EXPECT_EQ(nodes[a]->parent, nodes[b]);
+  EXPECT_EQ(ReconstructPath(nodes[c]), tree.ReconstructPath(c));
+}
+
+TEST(UnitTest, TreeSaveLoadRoundTrip)
+{
+  Tree tree;
+  auto root{tree.AddNode(Node(3, 4), kInvalidNodeIndex, Cost{})};
+  auto child{tree.AddNode(Node(7, 8), root, Cost(1, 5.6))};
+  tree.AddNode(Node(9, 9), child, Cost(2, 8.4));
+
+  std::stringstream stream;
+  tree.Save(stream);
+  Tree loaded;
+  ASSERT_TRUE(loaded.Load(stream));
+  ASSERT_EQ(loaded.Size(), tree.Size());
+  for (auto i = 0u; i < tree.Size(); i++)
+    {
+      EXPECT_EQ(loaded.GetNode(i), tree.GetNode(i));
+      EXPECT_EQ(loaded.GetParent(i), tree.GetParent(i));
+      EXPECT_EQ(loaded.GetFirstChild(i), tree.GetFirstChild(i));
+      EXPECT_DOUBLE_EQ(loaded.GetCost(i).f, tree.GetCost(i).f);
+    }
+
+  std::stringstream truncated(stream.str().substr(0, 20));
+  EXPECT_FALSE(loaded.Load(truncated));
+  EXPECT_TRUE(loaded.Empty());
+}
+
+TEST(UnitTest, TreeLoadRejectsCorruptFiles)
+{
+  Tree tree;
+  auto root{tree.AddNode(Node(3, 4), kInvalidNodeIndex, Cost{})};
+  auto child{tree.AddNode(Node(7, 8), root, Cost(1, 5.6))};
+  tree.AddNode(Node(9, 9), child, Cost(2, 8.4));
+  std::stringstream stream;
+  tree.Save(stream);
+  const auto bytes{stream.str()};
+  const auto size_offset{sizeof(std::uint32_t)};
+  const auto parent_offset{size_offset + sizeof(std::uint64_t) +
+                           2 * 3 * sizeof(int)};
+
+  auto huge_size{bytes};
+  const std::uint64_t size{std::uint64_t{1} << 60};
+  huge_size.replace(size_offset, sizeof(size),
+                    reinterpret_cast<const char *>(&size), sizeof(size));
+  std::stringstream huge_stream(huge_size);
+  Tree loaded;
+  EXPECT_FALSE(loaded.Load(huge_stream));
+
+  auto bad_parent{bytes};
+  const NodeIndex parent{99};
+  bad_parent.replace(parent_offset + 2 * sizeof(NodeIndex), sizeof(parent),
+                     reinterpret_cast<const char *>(&parent), sizeof(parent));
+  std::stringstream bad_parent_stream(bad_parent);
+  EXPECT_FALSE(loaded.Load(bad_parent_stream));
+
+  // Root under its grandchild, indices in range but the chain never ends.
+  auto cycle{bytes};
+  const NodeIndex grandchild{2};
+  cycle.replace(parent_offset, sizeof(grandchild),
+                reinterpret_cast<const char *>(&grandchild),
+                sizeof(grandchild));
+  std::stringstream cycle_stream(cycle);
+  EXPECT_FALSE(loaded.Load(cycle_stream));
+  EXPECT_TRUE(loaded.Empty());
+}
+
+TEST(UnitTest, ConcurrentTreeRewiresWithoutCycles)
+{
+  constexpr auto kThreadCount{4};
+  constexpr auto kNodeCount{2000};
+  ConcurrentTree tree(kThreadCount * kNodeCount + 1);
+  std::vector<NodeIndex> added{tree.AddNode(Node(0, 0), kInvalidNodeIndex)};
+  std::mutex added_mutex;
+  auto pick = [&added, &added_mutex](std::mt19937 &generator) {
+    std::lock_guard<std::mutex> lock(added_mutex);
+    return added[generator() % added.size()];
+  };
+
+  // Threads add nodes below random nodes and rewire random pairs.
+  auto grow = [&tree, &added, &added_mutex, &pick](const unsigned int seed) {
+    std::mt19937 generator(seed);
+    std::vector<NodeIndex> update_stack;
+    for (auto i = 0; i < kNodeCount; i++)
+      {
+        const auto node{Node(generator() % 100, generator() % 100)};
+        const auto index{tree.AddNode(node, pick(generator))};
+        {
+          std::lock_guard<std::mutex> lock(added_mutex);
+          added.push_back(index);
+        }
+        const auto child{pick(generator)};
+        const auto parent{pick(generator)};
+        if (child != parent && tree.Rewire(child, parent))
+          {
+            tree.UpdateCosts(child, update_stack);
+          }
+      }
+  };
+  std::vector<std::thread> threads;
+  for (auto i = 0u; i < kThreadCount; i++)
+    {
+      threads.emplace_back(grow, i);
+    }
+  for (auto &thread : threads)
+    {
+      thread.join();
+    }
+
+  ASSERT_EQ(tree.Size(), kThreadCount * kNodeCount + 1u);
+  EXPECT_EQ(tree.AddNode(Node(0, 0), 0), kInvalidNodeIndex);
+  auto node_parents{tree.ToNodeParents()};
+  ASSERT_EQ(node_parents.size(), tree.Size());
+  for (auto i = 0u; i < tree.Size(); i++)
+    {
+      // Every chain ends at the root, and stored costs bound the exact ones.
+      auto depth{0u};
+      auto current{static_cast<NodeIndex>(i)};
+      while (tree.GetParent(current) != kInvalidNodeIndex &&
+             depth <= tree.Size())
+        {
+          current = tree.GetParent(current);
+          depth++;
+        }
+      EXPECT_EQ(current, 0u);
+      EXPECT_DOUBLE_EQ(node_parents[i]->cost.g, depth);
+      EXPECT_GE(tree.GetCost(i).f + 1e-6, node_parents[i]->cost.f);
+    }
+}
+
+} // namespace planning
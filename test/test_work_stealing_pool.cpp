@@ -0,0 +1,64 @@
+/**
+ * @file test_work_stealing_pool.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "utility/work_stealing_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace planning
+{
+
+TEST(WorkStealingPoolTest, RunsEveryTaskOnce)
+{
+  WorkStealingPool pool(4);
+  ASSERT_EQ(pool.GetThreadCount(), 4u);
+  for (const auto count : {0u, 1u, 3u, 1000u})
+    {
+      std::vector<std::atomic<int>> runs(count);
+      std::vector<unsigned int> workers(count);
+      pool.Run(count, [&](const std::size_t index, const unsigned int worker) {
+        runs[index]++;
+        workers[index] = worker;
+      });
+      for (auto i = 0u; i < count; i++)
+        {
+          EXPECT_EQ(runs[i].load(), 1);
+          EXPECT_LT(workers[i], 4u);
+        }
+    }
+}
+
+TEST(WorkStealingPoolTest, IdleWorkerStealsSlowTasks)
+{
+  WorkStealingPool pool(2);
+  std::atomic<int> runs_on_worker_one{0};
+  // First half starts on worker 0 and is slow, worker 1 runs dry at once.
+  pool.Run(20, [&](const std::size_t index, const unsigned int worker) {
+    if (index < 10)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      }
+    if (worker == 1)
+      {
+        runs_on_worker_one++;
+      }
+  });
+
+  EXPECT_GT(pool.GetStealCount(), 0u);
+  EXPECT_GT(runs_on_worker_one.load(), 10);
+}
+
+} // namespace planning
@@ -0,0 +1,129 @@
+/**
+ * @file benchmark.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Compare planner modes on a sample map.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "tree_base/parallel_rrt_star/parallel_rrt_star.h"
+#include "tree_base/rrt_star/rrt_star.h"
+#include "utility/common_planning.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+namespace
+{
+
+const auto kStartNode{planning::Node(90, 185)};
+const auto kGoalNode{planning::Node(445, 336)};
+
+double Milliseconds(const std::chrono::nanoseconds &time)
+{
+  return std::chrono::duration<double, std::milli>(time).count();
+}
+
+double GoalCost(const planning::Path &path)
+{
+  auto cost{0.0};
+  for (auto i = 1u; i < path.size(); i++)
+    {
+      cost += planning::EuclideanDistance(path[i - 1], path[i]);
+    }
+  return cost;
+}
+
+/**
+ * @brief RRT* with eager and lazy collision checking on the same seeds.
+ *
+ */
+void BenchmarkLazyCollision(const std::shared_ptr<planning::Map> map,
+                            const int seed_count, const int max_iteration)
+{
+  std::printf("seed mode  total_ms collision_ms rays   length\n");
+  for (auto seed = 1; seed <= seed_count; seed++)
+    {
+      for (const auto lazy : {false, true})
+        {
+          planning::tree_base::BasicRRTStar<planning::NoLogging> planner(
+              max_iteration, 10, 5, 15, 5);
+          planner.SetSeed(static_cast<std::uint64_t>(seed));
+          planner.SetLazyCollisionChecking(lazy);
+          const auto path{planner.FindPath(kStartNode, kGoalNode, map)};
+          const auto stats{planner.GetStats()};
+          std::printf("%4d %-5s %8.1f %12.1f %6zu %6.1f\n", seed,
+                      lazy ? "lazy" : "eager", Milliseconds(stats.total_time),
+                      Milliseconds(stats.collision_time + stats.rewire_time),
+                      stats.collision_checks, GoalCost(path));
+        }
+    }
+}
+
+/**
+ * @brief Parallel RRT* cost versus time at 1, 4 and 16 threads, with the
+ * iteration budget halved down to an eighth of max_iteration. A run without
+ * a path prints length 0.
+ *
+ */
+void BenchmarkParallel(const std::shared_ptr<planning::Map> map,
+                       const int seed_count, const int max_iteration)
+{
+  std::printf("seed threads iterations total_ms length\n");
+  for (auto seed = 1; seed <= seed_count; seed++)
+    {
+      for (const auto thread_count : {1u, 4u, 16u})
+        {
+          for (auto iterations = max_iteration / 8;
+               iterations <= max_iteration; iterations *= 2)
+            {
+              planning::tree_base::ParallelRRTStar planner(
+                  iterations, 10, 5, 15, 5, thread_count);
+              planner.SetSeed(static_cast<std::uint64_t>(seed));
+              const auto start{std::chrono::steady_clock::now()};
+              const auto path{planner.FindPath(kStartNode, kGoalNode, map)};
+              const auto time{std::chrono::steady_clock::now() - start};
+              std::printf("%4d %7u %10d %8.1f %6.1f\n", seed, thread_count,
+                          iterations, Milliseconds(time), GoalCost(path));
+            }
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+    {
+      std::printf("Usage: benchmark lazy_collision|parallel [seed count] "
+                  "[iterations]\n");
+      return 1;
+    }
+
+  std::string map_file{std::string(DATA_DIR) + "/bg2/AR0072SR.map"};
+  const auto map{std::make_shared<planning::Map>(map_file)};
+  const std::string scenario{argv[1]};
+  const auto seed_count{argc > 2 ? std::atoi(argv[2]) : 5};
+  const auto max_iteration{argc > 3 ? std::atoi(argv[3]) : 10000};
+  if (scenario == "lazy_collision")
+    {
+      BenchmarkLazyCollision(map, seed_count, max_iteration);
+      return 0;
+    }
+  if (scenario == "parallel")
+    {
+      BenchmarkParallel(map, seed_count, max_iteration);
+      return 0;
+    }
+
+  std::printf("Unknown scenario %s.\n", scenario.c_str());
+  return 1;
+}
@@ -0,0 +1,121 @@
+/**
+ * @file trace_replay.cpp
+ * @author Bilal Kahraman (kahramannbilal@gmail.com)
+ * @brief Replay a recorded search trace in the visualizer, or print it.
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "visualizer.h"
+#include "utility/common_planning.h"
+#include "utility/search_trace.h"
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+
+// Events added to the window every frame.
+constexpr std::size_t kEventsPerFrame{200};
+
+/**
+ * @brief One event per line, for analysis scripts: "expansion x y",
+ * "edge index x y parent", "rewire index parent" and "path x y" per waypoint.
+ * Root edges have parent -1.
+ *
+ */
+void PrintTrace(const planning::SearchTrace &trace)
+{
+  std::cout << "planner " << trace.planner_name << " " << trace.height << " "
+            << trace.width << "\n";
+  for (const auto &event : trace.events)
+    {
+      const auto parent{event.parent == planning::kNoTraceParent
+                            ? std::string("-1")
+                            : std::to_string(event.parent)};
+      switch (event.type)
+        {
+        case planning::TraceEventType::kExpansion:
+          std::cout << "expansion " << event.node.x_ << " " << event.node.y_
+                    << "\n";
+          break;
+        case planning::TraceEventType::kEdge:
+          std::cout << "edge " << event.index << " " << event.node.x_ << " "
+                    << event.node.y_ << " " << parent << "\n";
+          break;
+        case planning::TraceEventType::kRewire:
+          std::cout << "rewire " << event.index << " " << parent << "\n";
+          break;
+        default:
+          break;
+        }
+    }
+  for (const auto &node : trace.path)
+    {
+      std::cout << "path " << node.x_ << " " << node.y_ << "\n";
+    }
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  if (argc < 2)
+    {
+      std::cout << "Usage: trace_replay <trace file> [map file | --print]"
+                << std::endl;
+      return 1;
+    }
+
+  std::ifstream stream(argv[1], std::ios::binary);
+  planning::SearchTrace trace;
+  if (!stream || !planning::ReadSearchTrace(stream, trace))
+    {
+      std::cout << "Invalid trace file." << std::endl;
+      return 1;
+    }
+
+  std::string map_file{argc > 2 ? argv[2] : "--print"};
+  if (map_file == "--print")
+    {
+      PrintTrace(trace);
+      return 0;
+    }
+
+  const auto map = std::make_shared<planning::Map>(map_file);
+  if (map->GetHeight() != trace.height || map->GetWidth() != trace.width)
+    {
+      std::cout << "Trace was recorded on another map." << std::endl;
+      return 1;
+    }
+
+  tools::Visualizer visualizer(map, tools::pair_double{2.0, 2.0}, 1.0,
+                               "Trace Replay", trace.planner_name);
+  if (!trace.path.empty())
+    {
+      visualizer.SetStartAndGoal(trace.path.front(), trace.path.back());
+    }
+
+  std::size_t event_count{0};
+  visualizer.SetReadLogFunction(
+      [&trace, &event_count](planning::LogCursor &cursor, planning::Log &log) {
+        event_count += kEventsPerFrame;
+        planning::ReplaySearchTrace(trace, event_count, cursor, log);
+      });
+  while (visualizer.IsRunning())
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+  visualizer.SetReadLogFunction(nullptr);
+
+  return 0;
+}
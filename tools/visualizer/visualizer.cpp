@@ -36,7 +36,12 @@ Visualizer::Visualizer(std::shared_ptr<planning::Map> map,
     {
       viz_function_ = std::bind(&Visualizer::VizGridLog, this);
     }
-  else if (planner_name_ == "rrt" || planner_name_ == "rrt_star")
+  else if (planner_name_ == "rrt" || planner_name_ == "rrt_star" ||
+           planner_name_ == "rrt_connect" ||
+           planner_name_ == "parallel_rrt_star" ||
+           planner_name_ == "fmt_star" || planner_name_ == "prm" ||
+           planner_name_ == "lazy_prm" ||
+           planner_name_ == "theta_star" || planner_name_ == "lazy_theta_star")
     {
       viz_function_ = std::bind(&Visualizer::VizTreeLog, this);
     }
@@ -78,11 +83,12 @@ void Visualizer::RenderMap()
 
 void Visualizer::VizGridLog()
 {
-  if (get_log_function_ == nullptr)
+  if (read_log_function_ == nullptr)
     {
       return;
     }
-  auto log = get_log_function_();
+  read_log_function_(log_cursor_, log_);
+  const auto &log{log_};
   auto color = colors_.at(planning::NodeState::kVisited);
   SDL_FRect *points = new SDL_FRect[log.first.size()];
   for (int i = 0; i < log.first.size(); i++)
@@ -116,11 +122,12 @@ void Visualizer::VizGridLog()
 
 void Visualizer::VizTreeLog()
 {
-  if (get_log_function_ == nullptr)
+  if (read_log_function_ == nullptr)
     {
       return;
     }
-  auto log = get_log_function_();
+  read_log_function_(log_cursor_, log_);
+  const auto &log{log_};
   auto color = colors_.at(planning::NodeState::kVisited);
   SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
   for (auto &node_parent : log.first)
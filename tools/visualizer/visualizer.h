@@ -55,9 +55,16 @@ public:
   void VizGridLog();
   void VizTreeLog();
 
-  void SetGetLogFunction(std::function<planning::Log()> get_log_function)
+  /**
+   * @brief Function that brings a log up to date from a cursor, called every
+   * frame. Only entries added since the last frame are copied.
+   *
+   */
+  void SetReadLogFunction(
+      std::function<void(planning::LogCursor &, planning::Log &)>
+          read_log_function)
   {
-    get_log_function_ = get_log_function;
+    read_log_function_ = read_log_function;
   }
 
   void Run();
@@ -80,7 +87,10 @@ private:
   SDL_Window *win = NULL;
   SDL_Renderer *renderer = NULL;
   std::function<void()> viz_function_;
-  std::function<planning::Log()> get_log_function_;
+  std::function<void(planning::LogCursor &, planning::Log &)>
+      read_log_function_;
+  planning::LogCursor log_cursor_;
+  planning::Log log_;
 
   planning::Node start_node_;
   planning::Node goal_node_;